@@ -0,0 +1,238 @@
+/**
+ * @file AdaptivePathFinder.cpp
+ * @brief Adaptive A* that learns heuristics across repeated queries - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the AdaptivePathFinder: A* over
+ * stamped flat arrays, the heuristic and successor updates after each
+ * search, and the least-recently-used memory budget.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "AdaptivePathFinder.h"
+#include <algorithm>
+#include <cstdlib>
+
+AdaptivePathFinder::AdaptivePathFinder(const PathFinder &engine, size_t memoryBudgetBytes)
+    : pathfinder(engine), memoryBudget(memoryBudgetBytes), learnedVersion(engine.getMapVersion()), searchId(0)
+{
+}
+
+AdaptivePathFinder::TargetMemory &AdaptivePathFinder::memoryFor(int targetIndex)
+{
+    auto found = memories.find(targetIndex);
+    if (found != memories.end())
+    {
+        recency.splice(recency.begin(), recency, found->second.lruEntry);
+        return found->second;
+    }
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    size_t tileCount = static_cast<size_t>(map.width) * map.height;
+
+    TargetMemory &memory = memories[targetIndex];
+    memory.learnedH.assign(tileCount, 0);
+    memory.successor.assign(tileCount, -1);
+    recency.push_front(targetIndex);
+    memory.lruEntry = recency.begin();
+
+    enforceBudget(targetIndex);
+    stats.targetsRemembered = memories.size();
+    return memory;
+}
+
+void AdaptivePathFinder::enforceBudget(int keep)
+{
+    const BattleMap &map = pathfinder.getBattleMap();
+    size_t bytesPerTarget = static_cast<size_t>(map.width) * map.height * 2 * sizeof(int);
+
+    // The target being searched always stays, even if it alone exceeds the budget
+    while (memories.size() > 1 && memories.size() * bytesPerTarget > memoryBudget)
+    {
+        int victim = recency.back();
+        if (victim == keep)
+            break;
+        recency.pop_back();
+        memories.erase(victim);
+        stats.evictions++;
+    }
+    stats.targetsRemembered = memories.size();
+}
+
+void AdaptivePathFinder::clear()
+{
+    memories.clear();
+    recency.clear();
+    stats.targetsRemembered = 0;
+}
+
+void AdaptivePathFinder::forgetTarget(const Position &target)
+{
+    const BattleMap &map = pathfinder.getBattleMap();
+    auto found = memories.find(target.y * map.width + target.x);
+    if (found == memories.end())
+        return;
+
+    recency.erase(found->second.lruEntry);
+    memories.erase(found);
+    stats.targetsRemembered = memories.size();
+}
+
+void AdaptivePathFinder::setMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+    enforceBudget(recency.empty() ? -1 : recency.front());
+}
+
+std::vector<Position> AdaptivePathFinder::findPath(const Position &start, const Position &target)
+{
+    lastSearchStats = SearchStats();
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    // Learned values may overestimate once tiles have changed
+    if (learnedVersion != pathfinder.getMapVersion())
+    {
+        clear();
+        learnedVersion = pathfinder.getMapVersion();
+    }
+
+    stats.searches++;
+    int width = map.width;
+    size_t tileCount = static_cast<size_t>(width) * map.height;
+    if (stamp.size() != tileCount)
+    {
+        gCost.assign(tileCount, 0);
+        parent.assign(tileCount, -1);
+        stamp.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        // Stamp wrap-around: invalidate everything once every 2^32 searches
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+
+    int targetIndex = target.y * width + target.x;
+    TargetMemory &memory = memoryFor(targetIndex);
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+
+    auto heuristic = [&](int index)
+    {
+        int manhattan = std::abs(index % width - target.x) + std::abs(index / width - target.y);
+        return std::max(manhattan, memory.learnedH[index]);
+    };
+
+    int startIndex = start.y * width + start.x;
+    stamp[startIndex] = searchId;
+    gCost[startIndex] = 0;
+    parent[startIndex] = -1;
+    closed[startIndex] = 0;
+    open.clear();
+    expandedTiles.clear();
+    OpenEntry first = {heuristic(startIndex), heuristic(startIndex), startIndex};
+    open.push_back(first);
+    lastSearchStats.nodesGenerated = 1;
+
+    int reached = -1; // Tile where the search ended (target or a tile with a known path)
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        int current = open.back().index;
+        open.pop_back();
+        if (closed[current])
+            continue;
+
+        closed[current] = 1;
+        expandedTiles.push_back(current);
+        lastSearchStats.nodesExpanded++;
+
+        // A remembered optimal path from here finishes the search (Tree-AA* reuse)
+        if (current == targetIndex || memory.successor[current] >= 0)
+        {
+            reached = current;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int nextCost = gCost[current] + 1;
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            if (stamp[neighbor] != searchId)
+            {
+                stamp[neighbor] = searchId;
+                closed[neighbor] = 0;
+            }
+            else if (closed[neighbor] || gCost[neighbor] <= nextCost)
+            {
+                continue;
+            }
+
+            gCost[neighbor] = nextCost;
+            parent[neighbor] = current;
+            int h = heuristic(neighbor);
+            OpenEntry entry = {nextCost + h, h, neighbor};
+            open.push_back(entry);
+            std::push_heap(open.begin(), open.end());
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (reached < 0)
+        return {};
+
+    // Path: start -> reached from the search tree, then the remembered tail
+    std::vector<int> tiles;
+    for (int index = reached; index >= 0; index = parent[index])
+    {
+        tiles.push_back(index);
+    }
+    std::reverse(tiles.begin(), tiles.end());
+    if (reached != targetIndex)
+    {
+        stats.pathReuses++;
+        for (int index = memory.successor[reached]; index >= 0; index = memory.successor[index])
+        {
+            tiles.push_back(index);
+            if (index == targetIndex)
+                break;
+        }
+    }
+
+    int goalCost = static_cast<int>(tiles.size()) - 1;
+    lastSearchStats.pathCost = goalCost;
+
+    // Adaptive A* update: h(s) = g(goal) - g(s) for every expanded tile
+    for (int index : expandedTiles)
+    {
+        memory.learnedH[index] = std::max(memory.learnedH[index], goalCost - gCost[index]);
+    }
+
+    // Remember the optimal path so later searches can stop on it
+    for (size_t i = 0; i + 1 < tiles.size(); ++i)
+    {
+        memory.successor[tiles[i]] = tiles[i + 1];
+        memory.learnedH[tiles[i]] = goalCost - static_cast<int>(i);
+    }
+
+    std::vector<Position> path;
+    path.reserve(tiles.size());
+    for (int index : tiles)
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    return path;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file AdaptivePathFinder.h
+ * @brief Adaptive A* that learns heuristics across repeated queries - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the AdaptivePathFinder, an A* engine that remembers,
+ * per target, improved heuristic values and the optimal paths it has found
+ * (Adaptive A* with the path reuse of Tree Adaptive A*). Units that replan
+ * toward the same objective get cheaper searches the more often they ask.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef ADAPTIVEPATHFINDER_H
+#define ADAPTIVEPATHFINDER_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @brief Counters describing the learned-heuristic memory
+ */
+struct AdaptiveStats
+{
+    size_t searches;          ///< Searches run
+    size_t pathReuses;        ///< Searches finished early on a remembered path
+    size_t targetsRemembered; ///< Targets currently holding learned data
+    size_t evictions;         ///< Targets dropped to stay within the memory budget
+
+    /**
+     * @brief Default constructor initializing all counters to zero
+     */
+    AdaptiveStats() : searches(0), pathReuses(0), targetsRemembered(0), evictions(0) {}
+};
+
+/**
+ * @brief A* search that learns a better heuristic per target after every search
+ *
+ * After a successful search with goal cost g(goal), every expanded tile s gets
+ * h(s) = g(goal) - g(s), which stays admissible and consistent. Later searches
+ * to the same target use max(Manhattan, learned h), so they focus on the
+ * corridor found before and expand fewer nodes. The tiles of each optimal path
+ * also remember their successor toward the target: once a later search expands
+ * such a tile, the rest of the path is known and the search stops.
+ *
+ * Memory is a pair of int arrays per remembered target (8 bytes per map tile).
+ * Targets are kept in least recently used order within the memory budget.
+ *
+ * @par Usage Example:
+ * @code
+ * AdaptivePathFinder adaptive(pathfinder);
+ * for (Unit &unit : squad)
+ *     unit.path = adaptive.findPath(unit.pos, objective); // Later units reuse earlier work
+ * @endcode
+ *
+ * @warning Remembered paths are only valid for the terrain they were found
+ *          on. Everything is forgotten automatically when the engine's map
+ *          version changes (PathFinder::setTile() or a reload); terrain edited
+ *          any other way requires an explicit clear().
+ */
+class AdaptivePathFinder
+{
+private:
+    /**
+     * @brief Learned data for one target
+     */
+    struct TargetMemory
+    {
+        std::vector<int> learnedH;         ///< Learned heuristic per tile (0 = nothing learned)
+        std::vector<int> successor;        ///< Next tile on a known optimal path (-1 = unknown)
+        std::list<int>::iterator lruEntry; ///< Position in the recency list
+    };
+
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int h;     ///< Heuristic, lower wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then lowest h
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return h > other.h;
+        }
+    };
+
+    const PathFinder &pathfinder;                   ///< Engine providing map and move order
+    size_t memoryBudget;                            ///< Bytes allowed for learned data
+    std::unordered_map<int, TargetMemory> memories; ///< Learned data keyed by target tile index
+    std::list<int> recency;                         ///< Target tile indices, most recent first
+    AdaptiveStats stats;                            ///< Memory and reuse counters
+    SearchStats lastSearchStats;                    ///< Effort of the last search
+    uint64_t learnedVersion;                        ///< Map version the learned data belongs to
+
+    std::vector<int> gCost;         ///< Cost per tile, valid where stamp matches
+    std::vector<int> parent;        ///< Predecessor tile index per tile
+    std::vector<uint32_t> stamp;    ///< Search id that last touched each tile
+    std::vector<uint8_t> closed;    ///< Expanded flag, valid where stamp matches
+    std::vector<int> expandedTiles; ///< Tiles expanded by the current search
+    std::vector<OpenEntry> open;    ///< Binary heap of open entries
+    uint32_t searchId;              ///< Current search id
+
+    /**
+     * @brief Get (creating if needed) the memory for a target and mark it most recent
+     * @param targetIndex Target tile index
+     * @return Memory of the target
+     */
+    TargetMemory &memoryFor(int targetIndex);
+
+    /**
+     * @brief Drop least recently used targets until the budget holds
+     * @param keep Target that must not be evicted
+     */
+    void enforceBudget(int keep);
+
+public:
+    /**
+     * @brief Create an adaptive engine over a loaded PathFinder
+     * @param engine Engine providing the map and move order (must outlive this object)
+     * @param memoryBudgetBytes Bytes of learned data to keep across all targets
+     */
+    explicit AdaptivePathFinder(const PathFinder &engine, size_t memoryBudgetBytes = 32u * 1024u * 1024u);
+
+    /**
+     * @brief Find an optimal path, learning from the search for later queries
+     * @param start Start position
+     * @param target Target position
+     * @return Path from start to target, empty if none exists
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target);
+
+    /**
+     * @brief Forget everything learned (needed after terrain edits that bypass PathFinder::setTile())
+     */
+    void clear();
+
+    /**
+     * @brief Forget what was learned for one target
+     * @param target Target position
+     */
+    void forgetTarget(const Position &target);
+
+    /**
+     * @brief Change the memory budget, evicting targets if needed
+     * @param bytes Bytes of learned data to keep across all targets
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Get search effort of the last findPath() call
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+
+    /**
+     * @brief Get memory and reuse counters
+     */
+    const AdaptiveStats &getStats() const { return stats; }
+};
+
+#endif // ADAPTIVEPATHFINDER_H
@@ -0,0 +1,253 @@
+/**
+ * @file AlternativePaths.cpp
+ * @brief K alternative routes with bounded overlap by iterative penalized A* - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of AlternativePaths: the backward
+ * distance plane used as heuristic, A* over penalized tile costs, and the
+ * loop that penalizes each route and filters candidates by overlap.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "AlternativePaths.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // A* runs allowed per requested route before giving up
+    const int ITERATIONS_PER_ROUTE = 8;
+
+    // Extra cost added to a tile each time a route uses it
+    const uint32_t PENALTY_STEP = 1;
+}
+
+AlternativePaths::AlternativePaths(const PathFinder &engine)
+    : pathfinder(engine), maxStretch(2.0), maxIterations(ITERATIONS_PER_ROUTE), width(0), distanceVersion(0),
+      distanceTarget(-1), searchId(0), callId(0), markId(0), lastIterations(0)
+{
+}
+
+void AlternativePaths::setMaxStretch(double stretch)
+{
+    maxStretch = std::max(1.0, stretch);
+}
+
+void AlternativePaths::prepare(const BattleMap &map, int targetIndex)
+{
+    size_t tileCount = static_cast<size_t>(map.width) * map.height;
+    if (distance.size() != tileCount || width != map.width)
+    {
+        width = map.width;
+        distance.assign(tileCount, -1);
+        penalty.assign(tileCount, 0);
+        penaltyStamp.assign(tileCount, 0);
+        mark.assign(tileCount, 0);
+        gCost.assign(tileCount, 0);
+        parent.assign(tileCount, -1);
+        stamp.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        searchId = 0;
+        callId = 0;
+        markId = 0;
+        distanceTarget = -1;
+    }
+
+    if (distanceTarget != targetIndex || distanceVersion != pathfinder.getMapVersion())
+    {
+        // Moves are 4-connected and symmetric, so a BFS from the target gives every tile's distance to it
+        std::fill(distance.begin(), distance.end(), -1);
+        std::vector<int> queue;
+        queue.push_back(targetIndex);
+        distance[targetIndex] = 0;
+        const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            int current = queue[head];
+            int x = current % width;
+            int y = current / width;
+            for (const auto &direction : directions)
+            {
+                int nx = x + direction.first;
+                int ny = y + direction.second;
+                if (!map.isReachable(nx, ny))
+                    continue;
+                int neighbor = ny * width + nx;
+                if (distance[neighbor] >= 0)
+                    continue;
+                distance[neighbor] = distance[current] + 1;
+                queue.push_back(neighbor);
+            }
+        }
+        distanceTarget = targetIndex;
+        distanceVersion = pathfinder.getMapVersion();
+    }
+}
+
+std::vector<int> AlternativePaths::search(const BattleMap &map, int startIndex, int targetIndex)
+{
+    if (++searchId == 0)
+    {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+
+    auto push = [&](int index, int from, int cost)
+    {
+        if (stamp[index] != searchId)
+        {
+            stamp[index] = searchId;
+            closed[index] = 0;
+        }
+        else if (closed[index] || gCost[index] <= cost)
+        {
+            return;
+        }
+        gCost[index] = cost;
+        parent[index] = from;
+        OpenEntry entry = {cost + distance[index], cost, index};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        lastSearchStats.nodesGenerated++;
+    };
+
+    open.clear();
+    push(startIndex, -1, 0);
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.index;
+        if (closed[current] || entry.g != gCost[current])
+            continue;
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        if (current == targetIndex)
+        {
+            std::vector<int> route;
+            for (int index = targetIndex; index >= 0; index = parent[index])
+            {
+                route.push_back(index);
+            }
+            std::reverse(route.begin(), route.end());
+            return route;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+            int neighbor = ny * width + nx;
+            if (distance[neighbor] < 0)
+                continue; // Cut off from the target
+            int extra = penaltyStamp[neighbor] == callId ? static_cast<int>(penalty[neighbor]) : 0;
+            push(neighbor, current, entry.g + 1 + extra);
+        }
+    }
+    return {};
+}
+
+size_t AlternativePaths::sharedTiles(const std::vector<int> &route, const std::vector<int> &other)
+{
+    if (++markId == 0)
+    {
+        std::fill(mark.begin(), mark.end(), 0);
+        markId = 1;
+    }
+    for (size_t i = 1; i + 1 < other.size(); ++i)
+    {
+        mark[other[i]] = markId;
+    }
+    size_t shared = 0;
+    for (size_t i = 1; i + 1 < route.size(); ++i)
+    {
+        if (mark[route[i]] == markId)
+            shared++;
+    }
+    return shared;
+}
+
+std::vector<std::vector<Position>> AlternativePaths::findKPaths(const Position &start, const Position &target, int k,
+                                                               double diversity)
+{
+    lastSearchStats = SearchStats();
+    lastIterations = 0;
+    if (k < 1 || !pathfinder.isMapLoaded())
+        return {};
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    int startIndex = start.y * map.width + start.x;
+    int targetIndex = target.y * map.width + target.x;
+    prepare(map, targetIndex);
+    if (distance[startIndex] < 0)
+        return {};
+
+    if (++callId == 0)
+    {
+        std::fill(penaltyStamp.begin(), penaltyStamp.end(), 0);
+        callId = 1;
+    }
+
+    double maxOverlap = 1.0 - std::max(0.0, std::min(diversity, 1.0));
+    int lengthLimit = static_cast<int>(std::floor(distance[startIndex] * maxStretch + 1e-9));
+    std::vector<std::vector<int>> routes;
+    while (static_cast<int>(routes.size()) < k && lastIterations < k * maxIterations)
+    {
+        std::vector<int> route = search(map, startIndex, targetIndex);
+        lastIterations++;
+        if (route.empty())
+            break;
+
+        // An over-limit candidate is skipped but still penalized: the next optimum can be shorter in tiles
+        bool keep = static_cast<int>(route.size()) - 1 <= lengthLimit;
+        for (size_t r = 0; keep && r < routes.size(); ++r)
+        {
+            const std::vector<int> &kept = routes[r];
+            size_t shorterTiles = std::min(route.size(), kept.size()) - 2;
+            keep = route != kept && static_cast<double>(sharedTiles(route, kept)) <= maxOverlap * shorterTiles + 1e-9;
+        }
+        if (keep)
+            routes.push_back(route);
+
+        // With no tiles between start and target there is no other route to push toward
+        if (route.size() <= 2)
+            break;
+        for (size_t i = 1; i + 1 < route.size(); ++i)
+        {
+            int index = route[i];
+            if (penaltyStamp[index] != callId)
+            {
+                penaltyStamp[index] = callId;
+                penalty[index] = 0;
+            }
+            penalty[index] += PENALTY_STEP;
+        }
+    }
+
+    std::vector<std::vector<Position>> paths;
+    for (const std::vector<int> &route : routes)
+    {
+        std::vector<Position> path;
+        path.reserve(route.size());
+        for (int index : route)
+        {
+            path.push_back(Position(index % width, index / width));
+        }
+        paths.push_back(path);
+    }
+    if (!paths.empty())
+        lastSearchStats.pathCost = static_cast<int>(paths.front().size()) - 1;
+    return paths;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file AlternativePaths.h
+ * @brief K alternative routes with bounded overlap by iterative penalized A* - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines AlternativePaths, which finds up to k routes between
+ * two tiles that share at most a chosen fraction of their tiles. Units sent
+ * down different routes spread across corridors instead of queueing at the
+ * same chokepoint.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef ALTERNATIVEPATHS_H
+#define ALTERNATIVEPATHS_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Diverse alternative routes between two tiles
+ *
+ * Uses the penalty method. The first route is a shortest path. After every
+ * route found, each tile on it costs one more move to enter, and A* runs
+ * again on the penalized costs. A candidate is kept if, against every route
+ * kept so far, the tiles they share (start and target excluded) are at most
+ * (1 - diversity) of the shorter route's tiles. Candidates longer than the
+ * stretch limit times the shortest route are skipped but still penalized,
+ * since a later optimum on the penalized costs can be shorter in tiles. The
+ * search ends when k routes are kept or the iteration budget is spent.
+ *
+ * Search state is reused between iterations and calls. One backward BFS
+ * from the target gives the exact unpenalized distance of every tile. It
+ * serves as the A* heuristic of every iteration, since penalties never
+ * lower a cost. It is kept until the target or the map changes. Per-tile
+ * arrays are reset by search stamps rather than cleared.
+ *
+ * @par Usage Example:
+ * @code
+ * AlternativePaths routes(pathfinder);
+ * std::vector<std::vector<Position>> lanes = routes.findKPaths(start, target, 3, 0.6);
+ * for (size_t i = 0; i < squad.size(); ++i)
+ *     squad[i].follow(lanes[i % lanes.size()]);   // Spread the squad over the routes
+ * @endcode
+ *
+ * @note Queries on one instance are not thread safe.
+ */
+class AlternativePaths
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int g;     ///< Penalized cost from the start, higher wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing map and move order
+    double maxStretch;            ///< Longest accepted route relative to the shortest
+    int maxIterations;            ///< A* runs allowed per requested route
+
+    int width;                          ///< Map width of the buffers
+    uint64_t distanceVersion;           ///< Map version of the distance plane
+    int distanceTarget;                 ///< Target tile of the distance plane (-1 = none)
+    std::vector<int> distance;          ///< Moves from each tile to the target, -1 if unreachable
+    std::vector<uint32_t> penalty;      ///< Extra cost per tile, valid where penaltyStamp matches
+    std::vector<uint32_t> penaltyStamp; ///< Call id that last penalized each tile
+    std::vector<uint32_t> mark;         ///< Scratch marks for overlap counting
+    std::vector<int> gCost;             ///< Cost per tile, valid where stamp matches
+    std::vector<int> parent;            ///< Parent tile per tile (-1 for the start)
+    std::vector<uint32_t> stamp;        ///< Search id that last touched each tile
+    std::vector<uint8_t> closed;        ///< Expanded flag, valid where stamp matches
+    std::vector<OpenEntry> open;        ///< Binary heap of open entries
+    uint32_t searchId;                  ///< Current search id
+    uint32_t callId;                    ///< Current findKPaths() id
+    uint32_t markId;                    ///< Current overlap mark id
+    SearchStats lastSearchStats;        ///< Effort of the last call, summed over iterations
+    int lastIterations;                 ///< A* runs of the last call
+
+    /**
+     * @brief Size the buffers for the map and refresh the distance plane if needed
+     */
+    void prepare(const BattleMap &map, int targetIndex);
+
+    /**
+     * @brief Run A* on the penalized costs with the distance plane as heuristic
+     * @return Tile indices from start to target, empty if no path exists
+     */
+    std::vector<int> search(const BattleMap &map, int startIndex, int targetIndex);
+
+    /**
+     * @brief Count the tiles two routes share, start and target excluded
+     */
+    size_t sharedTiles(const std::vector<int> &route, const std::vector<int> &other);
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit AlternativePaths(const PathFinder &engine);
+
+    /**
+     * @brief Find up to k routes with bounded overlap
+     * @param start Start position
+     * @param target Target position
+     * @param k Number of routes wanted
+     * @param diversity Smallest fraction of the shorter route's tiles that two routes may not share, in [0, 1]
+     * @return Routes from start to target (both included), the shortest first; fewer than k if the
+     *         iteration budget ran out first, empty if no path exists
+     */
+    std::vector<std::vector<Position>> findKPaths(const Position &start, const Position &target, int k,
+                                                  double diversity = 0.5);
+
+    /**
+     * @brief Set the longest accepted route relative to the shortest one
+     * @param stretch At least 1 (default 2)
+     */
+    void setMaxStretch(double stretch);
+
+    /**
+     * @brief Get search effort of the last findKPaths() call, summed over its A* runs
+     *
+     * pathCost is the length in moves of the shortest route.
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+
+    /**
+     * @brief Get the number of A* runs of the last findKPaths() call
+     */
+    int getLastIterations() const { return lastIterations; }
+};
+
+#endif // ALTERNATIVEPATHS_H
@@ -0,0 +1,312 @@
+/**
+ * @file BatchQuery.cpp
+ * @brief High-throughput batch execution of path queries against one map - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the BatchQuery class: query file
+ * parsing (plain and MovingAI .scen), per-thread execution and ordered
+ * streaming of compact result lines.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "BatchQuery.h"
+#include "../PathScheduler/PathScheduler.h"
+#include "../TaskPool/TaskPool.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+    // Queries are executed in blocks so output streams while keeping input order
+    const size_t BLOCK_SIZE = 4096;
+
+    // Queries per pool task; small enough to balance long and short queries
+    const size_t TASK_GRAIN = 16;
+
+    bool isKnownAlgorithm(const std::string &algorithm)
+    {
+        return algorithm == "astar" || algorithm == "bfs" || algorithm == "dfs" || algorithm == "adaptive" ||
+               algorithm == "wastar" || algorithm == "focal";
+    }
+}
+
+bool BatchQuery::loadQueries(const std::string &filename, const std::string &defaultAlgorithm,
+                             std::vector<PathQuery> &queries, double defaultWeight)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open query file " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    bool scenario = false;
+
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        if (!line.empty() && line[line.size() - 1] == '\r')
+            line.erase(line.size() - 1);
+
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        if (lineNumber == 1 && line.compare(0, 7, "version") == 0)
+        {
+            scenario = true;
+            continue;
+        }
+
+        std::istringstream fields(line);
+        PathQuery query;
+        query.algorithm = defaultAlgorithm;
+        query.weight = defaultWeight;
+
+        if (scenario)
+        {
+            // bucket map width height sx sy tx ty optimal
+            int bucket, mapWidth, mapHeight;
+            std::string mapName;
+            if (!(fields >> bucket >> mapName >> mapWidth >> mapHeight >> query.start.x >> query.start.y >> query.target.x >> query.target.y >> query.expectedLength))
+            {
+                std::cerr << "Error: Malformed scenario line " << lineNumber << " in " << filename << std::endl;
+                return false;
+            }
+        }
+        else
+        {
+            if (!(fields >> query.start.x >> query.start.y >> query.target.x >> query.target.y))
+            {
+                std::cerr << "Error: Malformed query line " << lineNumber << " in " << filename << std::endl;
+                return false;
+            }
+
+            std::string algorithm;
+            if (fields >> algorithm)
+            {
+                if (!isKnownAlgorithm(algorithm))
+                {
+                    std::cerr << "Error: Unknown algorithm '" << algorithm << "' on line " << lineNumber << std::endl;
+                    return false;
+                }
+                query.algorithm = algorithm;
+
+                double weight;
+                if (fields >> weight)
+                {
+                    if (weight < 1.0)
+                    {
+                        std::cerr << "Error: Weight must be at least 1 on line " << lineNumber << std::endl;
+                        return false;
+                    }
+                    query.weight = weight;
+                }
+            }
+        }
+
+        queries.push_back(query);
+    }
+
+    return true;
+}
+
+PathQueryResult BatchQuery::execute(PathFinder &pathfinder, const PathQuery &query, bool keepPath,
+                                    AdaptivePathFinder *adaptive)
+{
+    PathQueryResult result;
+    const BattleMap &map = pathfinder.getBattleMap();
+
+    if (!map.isReachable(query.start.x, query.start.y) || !map.isReachable(query.target.x, query.target.y))
+    {
+        return result; // Invalid or blocked endpoints never have a path
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<Position> path;
+    if (query.algorithm == "adaptive" && adaptive)
+    {
+        path = adaptive->findPath(query.start, query.target);
+        result.nodesExpanded = adaptive->getLastSearchStats().nodesExpanded;
+    }
+    else
+    {
+        if (query.algorithm == "bfs")
+            path = pathfinder.findPathBFS(query.start, query.target);
+        else if (query.algorithm == "dfs")
+            path = pathfinder.findPathDFS(query.start, query.target);
+        else if (query.algorithm == "wastar")
+            path = pathfinder.findPathWeightedAStar(query.start, query.target, query.weight);
+        else if (query.algorithm == "focal")
+            path = pathfinder.findPathFocal(query.start, query.target, query.weight);
+        else
+            path = pathfinder.findPathAStar(query.start, query.target);
+        result.nodesExpanded = pathfinder.getLastSearchStats().nodesExpanded;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    result.microseconds = std::chrono::duration<double, std::micro>(end - begin).count();
+    result.pathLength = path.empty() ? -1 : PathFinder::calculatePathLength(path);
+    if (keepPath)
+        result.path.swap(path);
+
+    return result;
+}
+
+size_t BatchQuery::run(const PathFinder &pathfinder, const std::vector<PathQuery> &queries,
+                       int threads, bool emitPaths, std::ostream &out)
+{
+    bool parallel = threads > 1;
+    TaskPool *pool = parallel ? &TaskPool::shared() : nullptr;
+    std::vector<PathFinder> engines(parallel ? pool->size() : 1, pathfinder); // One private engine per worker
+    std::vector<std::unique_ptr<AdaptivePathFinder>> adaptive(engines.size());
+    for (size_t i = 0; i < engines.size(); ++i)
+    {
+        adaptive[i].reset(new AdaptivePathFinder(engines[i])); // Learns across the whole batch
+    }
+    std::vector<PathQueryResult> results;
+    size_t found = 0;
+
+    for (size_t blockStart = 0; blockStart < queries.size(); blockStart += BLOCK_SIZE)
+    {
+        size_t blockEnd = std::min(queries.size(), blockStart + BLOCK_SIZE);
+        results.assign(blockEnd - blockStart, PathQueryResult());
+
+        if (!parallel)
+        {
+            for (size_t i = blockStart; i < blockEnd; ++i)
+            {
+                results[i - blockStart] = execute(engines[0], queries[i], emitPaths, adaptive[0].get());
+            }
+        }
+        else
+        {
+            parallelFor(*pool, blockStart, blockEnd, TASK_GRAIN, [&](size_t begin, size_t end)
+                        {
+                            int worker = TaskPool::workerIndex();
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                results[i - blockStart] = execute(engines[worker], queries[i], emitPaths,
+                                                                  adaptive[worker].get());
+                            } });
+        }
+
+        found += writeBlock(queries, blockStart, results, emitPaths, out);
+    }
+
+    return found;
+}
+
+size_t BatchQuery::runScheduled(const PathFinder &pathfinder, const std::vector<PathQuery> &queries,
+                                int threads, bool emitPaths, std::ostream &out)
+{
+    PathScheduler scheduler(pathfinder, threads);
+    PathFinder direct(pathfinder); // Other algorithms bypass the scheduler
+    AdaptivePathFinder directAdaptive(direct);
+    std::vector<PathQueryResult> results;
+    size_t found = 0;
+
+    for (size_t blockStart = 0; blockStart < queries.size(); blockStart += BLOCK_SIZE)
+    {
+        size_t blockEnd = std::min(queries.size(), blockStart + BLOCK_SIZE);
+        results.assign(blockEnd - blockStart, PathQueryResult());
+
+        for (size_t i = blockStart; i < blockEnd; ++i)
+        {
+            const PathQuery &query = queries[i];
+            if (query.algorithm != "astar")
+            {
+                results[i - blockStart] = execute(direct, query, emitPaths, &directAdaptive);
+                continue;
+            }
+
+            PathQueryResult *result = &results[i - blockStart];
+            PathScheduler::Clock::time_point submitted = PathScheduler::Clock::now();
+            scheduler.submit(query.start, query.target, 0, PathScheduler::Clock::time_point::max(),
+                             [result, submitted, emitPaths](const PathResponse &response)
+                             {
+                                 result->microseconds = std::chrono::duration<double, std::micro>(
+                                                            PathScheduler::Clock::now() - submitted)
+                                                            .count();
+                                 result->nodesExpanded = response.nodesExpanded;
+                                 if (response.status == PathRequestStatus::FOUND)
+                                 {
+                                     result->pathLength = PathFinder::calculatePathLength(response.path);
+                                     if (emitPaths)
+                                         result->path = response.path;
+                                 } });
+        }
+
+        while (scheduler.pendingCount() > 0)
+        {
+            scheduler.tick(PathScheduler::Clock::now() + std::chrono::milliseconds(16));
+        }
+
+        found += writeBlock(queries, blockStart, results, emitPaths, out);
+    }
+
+    const SchedulerStats &stats = scheduler.getStats();
+    std::cerr << "Scheduler: " << stats.searchesRun << " searches, " << stats.flowFieldsBuilt
+              << " flow fields, " << stats.requestsMerged << " requests merged" << std::endl;
+    return found;
+}
+
+size_t BatchQuery::writeBlock(const std::vector<PathQuery> &queries, size_t blockStart,
+                              const std::vector<PathQueryResult> &results, bool emitPaths, std::ostream &out)
+{
+    size_t found = 0;
+    std::ostringstream block;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const PathQuery &query = queries[blockStart + i];
+        const PathQueryResult &result = results[i];
+        if (result.pathLength >= 0)
+            found++;
+
+        block << blockStart + i << ' ' << query.algorithm << ' '
+              << query.start.x << ' ' << query.start.y << ' '
+              << query.target.x << ' ' << query.target.y << ' '
+              << result.pathLength << ' ' << result.nodesExpanded << ' '
+              << static_cast<long long>(result.microseconds + 0.5);
+        if (query.expectedLength >= 0.0)
+            block << ' ' << query.expectedLength;
+        if (emitPaths)
+            block << ' ' << (result.path.empty() ? "-" : encodeMoves(result.path));
+        block << '\n';
+    }
+    out << block.str();
+    out.flush();
+    return found;
+}
+
+std::string BatchQuery::encodeMoves(const std::vector<Position> &path)
+{
+    std::string moves;
+    moves.reserve(path.size());
+
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        int dx = path[i].x - path[i - 1].x;
+        int dy = path[i].y - path[i - 1].y;
+        if (dx == 1)
+            moves.push_back('r');
+        else if (dx == -1)
+            moves.push_back('l');
+        else if (dy == 1)
+            moves.push_back('d');
+        else if (dy == -1)
+            moves.push_back('u');
+        else
+            moves.push_back('w');
+    }
+
+    return moves;
+}
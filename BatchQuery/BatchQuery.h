@@ -0,0 +1,153 @@
+/**
+ * @file BatchQuery.h
+ * @brief High-throughput batch execution of path queries against one map - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the BatchQuery library which reads many (start, target,
+ * algorithm) queries from a plain query file or a MovingAI scenario (.scen)
+ * file, executes them against a loaded map, optionally on several threads,
+ * and streams one compact result line per query.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef BATCHQUERY_H
+#define BATCHQUERY_H
+
+#include "../PathFinder/PathFinder.h"
+#include "../AdaptivePathFinder/AdaptivePathFinder.h"
+#include <string>
+#include <vector>
+#include <ostream>
+
+/**
+ * @brief A single path query
+ */
+struct PathQuery
+{
+    Position start;        ///< Start position
+    Position target;       ///< Target position
+    std::string algorithm; ///< Algorithm name: astar, bfs, dfs, adaptive, wastar or focal
+    double weight;         ///< Suboptimality bound for wastar and focal
+    double expectedLength; ///< Optimal length from a .scen file, or -1 if unknown
+
+    /**
+     * @brief Default constructor
+     */
+    PathQuery() : algorithm("astar"), weight(1.0), expectedLength(-1.0) {}
+};
+
+/**
+ * @brief Result of executing one PathQuery
+ */
+struct PathQueryResult
+{
+    int pathLength;             ///< Path length in steps, -1 if no path or invalid query
+    int nodesExpanded;          ///< Nodes expanded by the search
+    double microseconds;        ///< Search time
+    std::vector<Position> path; ///< Path (only kept when paths are emitted)
+
+    /**
+     * @brief Default constructor initializing a failed result
+     */
+    PathQueryResult() : pathLength(-1), nodesExpanded(0), microseconds(0.0) {}
+};
+
+/**
+ * @brief Loader and executor for batches of path queries
+ *
+ * @par Query File Formats:
+ * - Plain: one query per line, `sx sy tx ty [algorithm [weight]]`; blank
+ *   lines and lines starting with '#' are ignored
+ * - MovingAI scenario: a `version 1` header followed by tab separated
+ *   `bucket map width height sx sy tx ty optimal` lines
+ *
+ * @par Output Format:
+ * One line per query, in input order:
+ * `index algorithm sx sy tx ty length expanded microseconds [expected] [moves]`
+ * where moves is a string of r/d/l/u steps when path emission is enabled.
+ *
+ * @par Usage Example:
+ * @code
+ * std::vector<PathQuery> queries;
+ * BatchQuery::loadQueries("queries.txt", "astar", queries);
+ * BatchQuery::run(pathfinder, queries, 8, false, std::cout);
+ * @endcode
+ */
+class BatchQuery
+{
+private:
+    /**
+     * @brief Write the result lines of one block in input order
+     * @param queries All queries
+     * @param blockStart Index of the block's first query
+     * @param results Results of the block
+     * @param emitPaths Append the move string of each path
+     * @param out Stream receiving result lines
+     * @return Number of results with a path
+     */
+    static size_t writeBlock(const std::vector<PathQuery> &queries, size_t blockStart,
+                             const std::vector<PathQueryResult> &results, bool emitPaths, std::ostream &out);
+
+public:
+    /**
+     * @brief Load queries from a plain query file or a MovingAI .scen file
+     * @param filename Query file path
+     * @param defaultAlgorithm Algorithm for lines that do not name one
+     * @param queries Output vector receiving the queries
+     * @param defaultWeight Bound for wastar and focal lines that do not give one
+     * @return true if the file was read without errors
+     */
+    static bool loadQueries(const std::string &filename, const std::string &defaultAlgorithm,
+                            std::vector<PathQuery> &queries, double defaultWeight = 1.0);
+
+    /**
+     * @brief Execute a single query
+     * @param pathfinder Engine with the map loaded
+     * @param query Query to execute
+     * @param keepPath Keep the path in the result
+     * @param adaptive Learning engine over pathfinder, used for "adaptive" queries (may be null)
+     * @return Query result
+     */
+    static PathQueryResult execute(PathFinder &pathfinder, const PathQuery &query, bool keepPath,
+                                   AdaptivePathFinder *adaptive = nullptr);
+
+    /**
+     * @brief Execute all queries and stream result lines in input order
+     * @param pathfinder Engine with the map loaded (copied per pool worker)
+     * @param queries Queries to execute
+     * @param threads 1 = run on the calling thread, otherwise on the shared TaskPool
+     * @param emitPaths Append the move string of each path
+     * @param out Stream receiving result lines
+     * @return Number of queries for which a path was found
+     */
+    static size_t run(const PathFinder &pathfinder, const std::vector<PathQuery> &queries,
+                      int threads, bool emitPaths, std::ostream &out);
+
+    /**
+     * @brief Execute all queries through a PathScheduler and stream result lines in input order
+     * @param pathfinder Engine with the map loaded (copied into the scheduler)
+     * @param queries Queries to execute; A* queries are scheduled, the others run directly
+     * @param threads Jobs the scheduler runs concurrently on the shared TaskPool
+     * @param emitPaths Append the move string of each path
+     * @param out Stream receiving result lines
+     * @return Number of queries for which a path was found
+     *
+     * Identical and same-target A* queries share their computation, so the
+     * expanded column reports the shared work and microseconds the latency
+     * from submission to answer.
+     */
+    static size_t runScheduled(const PathFinder &pathfinder, const std::vector<PathQuery> &queries,
+                               int threads, bool emitPaths, std::ostream &out);
+
+    /**
+     * @brief Encode a path as a compact r/d/l/u move string
+     * @param path Path of adjacent positions
+     * @return Move string, one character per step ('w' for waiting in place)
+     */
+    static std::string encodeMoves(const std::vector<Position> &path);
+};
+
+#endif // BATCHQUERY_H
@@ -0,0 +1,411 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Benchmark corpus runner and noise-aware regression comparison - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the Benchmark class, which runs the
+ * pathfinding algorithms over a corpus of maps, persists the measurements as
+ * JSON and compares result files for performance regressions.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "Benchmark.h"
+#include "../MapLoader/MapLoader.h"
+#include "../PathFinder/PathFinder.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <dirent.h>
+#include <sys/stat.h>
+
+double WorkloadResult::meanLatency() const
+{
+    if (latencyUs.empty())
+        return 0.0;
+
+    double sum = 0.0;
+    for (double sample : latencyUs)
+    {
+        sum += sample;
+    }
+    return sum / latencyUs.size();
+}
+
+double WorkloadResult::latencyStdDev() const
+{
+    if (latencyUs.size() < 2)
+        return 0.0;
+
+    double mean = meanLatency();
+    double sumSquares = 0.0;
+    for (double sample : latencyUs)
+    {
+        sumSquares += (sample - mean) * (sample - mean);
+    }
+    return std::sqrt(sumSquares / (latencyUs.size() - 1));
+}
+
+// Recursively gather *.json files below a directory
+static void collectJsonFiles(const std::string &path, std::vector<std::string> &files)
+{
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+    {
+        std::cerr << "Warning: Corpus path not found: " << path << std::endl;
+        return;
+    }
+
+    if (!S_ISDIR(info.st_mode))
+    {
+        files.push_back(path);
+        return;
+    }
+
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr)
+    {
+        std::cerr << "Warning: Could not open corpus directory: " << path << std::endl;
+        return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        std::string name = entry->d_name;
+        if (name == "." || name == "..")
+            continue;
+
+        std::string child = path + "/" + name;
+        struct stat childInfo;
+        if (stat(child.c_str(), &childInfo) != 0)
+            continue;
+
+        if (S_ISDIR(childInfo.st_mode))
+        {
+            collectJsonFiles(child, files);
+        }
+        else if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0)
+        {
+            files.push_back(child);
+        }
+    }
+    closedir(dir);
+}
+
+std::vector<std::string> Benchmark::collectCorpus(const std::vector<std::string> &paths)
+{
+    std::vector<std::string> files;
+    for (const auto &path : paths)
+    {
+        collectJsonFiles(path, files);
+    }
+
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    return files;
+}
+
+bool Benchmark::runCorpus(const std::vector<std::string> &mapFiles, int repetitions,
+                          std::vector<WorkloadResult> &results)
+{
+    bool allLoaded = true;
+    const std::vector<std::string> algorithms = {"astar", "bfs", "dfs"};
+
+    for (const auto &mapFile : mapFiles)
+    {
+        MapLoader mapLoader;
+        if (!mapLoader.loadFromFile(mapFile) || mapLoader.getLayers().empty())
+        {
+            std::cerr << "Error: Failed to load benchmark map " << mapFile << std::endl;
+            allLoaded = false;
+            continue;
+        }
+
+        const Layer &layer = mapLoader.getLayers()[0];
+        PathFinder pathfinder;
+        if (!pathfinder.loadMapFromData(layer.data, layer.width, layer.height))
+        {
+            std::cerr << "Error: Failed to initialize pathfinder for " << mapFile << std::endl;
+            allLoaded = false;
+            continue;
+        }
+
+        for (const auto &algorithm : algorithms)
+        {
+            WorkloadResult result;
+            result.name = mapFile + ":" + algorithm;
+
+            for (int rep = 0; rep < repetitions; ++rep)
+            {
+                auto start = std::chrono::steady_clock::now();
+                std::vector<Position> path;
+                if (algorithm == "astar")
+                    path = pathfinder.findPathAStar();
+                else if (algorithm == "bfs")
+                    path = pathfinder.findPathBFS();
+                else
+                    path = pathfinder.findPathDFS();
+                auto end = std::chrono::steady_clock::now();
+
+                result.latencyUs.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+                result.nodesExpanded = pathfinder.getLastSearchStats().nodesExpanded;
+                result.pathLength = path.empty() ? -1 : PathFinder::calculatePathLength(path);
+            }
+
+            results.push_back(result);
+        }
+    }
+
+    return allLoaded;
+}
+
+bool Benchmark::saveResults(const std::string &filename, const std::vector<WorkloadResult> &results)
+{
+    Json::Value root;
+    root["version"] = 1;
+
+    Json::Value workloads(Json::arrayValue);
+    for (const auto &result : results)
+    {
+        Json::Value workload;
+        workload["name"] = result.name;
+        workload["nodes_expanded"] = result.nodesExpanded;
+        workload["path_length"] = result.pathLength;
+
+        Json::Value samples(Json::arrayValue);
+        for (double sample : result.latencyUs)
+        {
+            samples.append(sample);
+        }
+        workload["latency_us"] = samples;
+        workloads.append(workload);
+    }
+    root["workloads"] = workloads;
+
+    std::ofstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not write results file " << filename << std::endl;
+        return false;
+    }
+
+    Json::StreamWriterBuilder writer;
+    writer["indentation"] = "  ";
+    file << Json::writeString(writer, root) << std::endl;
+    return true;
+}
+
+bool Benchmark::loadResults(const std::string &filename, std::vector<WorkloadResult> &results)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Could not open results file " << filename << std::endl;
+        return false;
+    }
+
+    Json::Value root;
+    Json::CharReaderBuilder reader;
+    std::string errs;
+    if (!Json::parseFromStream(reader, file, &root, &errs))
+    {
+        std::cerr << "Error parsing results JSON: " << errs << std::endl;
+        return false;
+    }
+
+    if (!root.isMember("workloads") || !root["workloads"].isArray())
+    {
+        std::cerr << "Error: Results file missing workloads array" << std::endl;
+        return false;
+    }
+
+    for (const auto &workload : root["workloads"])
+    {
+        if (!workload.isMember("name") || !workload.isMember("latency_us"))
+        {
+            std::cerr << "Error: Workload missing name or latency_us" << std::endl;
+            return false;
+        }
+
+        WorkloadResult result;
+        result.name = workload["name"].asString();
+        result.nodesExpanded = workload.get("nodes_expanded", 0).asInt();
+        result.pathLength = workload.get("path_length", -1).asInt();
+        for (const auto &sample : workload["latency_us"])
+        {
+            result.latencyUs.push_back(sample.asDouble());
+        }
+        results.push_back(result);
+    }
+
+    return true;
+}
+
+double Benchmark::tCritical(double degreesOfFreedom, double confidence)
+{
+    // Two-sided critical values for 90%, 95% and 99% confidence
+    static const double dfs[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 12, 15, 20, 25, 30, 40, 60, 120, 1e9};
+    static const double t90[] = {6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+                                 1.782, 1.753, 1.725, 1.708, 1.697, 1.684, 1.671, 1.658, 1.645};
+    static const double t95[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                 2.179, 2.131, 2.086, 2.060, 2.042, 2.021, 2.000, 1.980, 1.960};
+    static const double t99[] = {63.657, 9.925, 5.841, 4.604, 4.032, 3.707, 3.499, 3.355, 3.250, 3.169,
+                                 3.055, 2.947, 2.845, 2.787, 2.750, 2.704, 2.660, 2.617, 2.576};
+    const int count = sizeof(dfs) / sizeof(dfs[0]);
+
+    const double *table = t95;
+    if (confidence <= 0.925)
+        table = t90;
+    else if (confidence >= 0.975)
+        table = t99;
+
+    double df = std::max(1.0, degreesOfFreedom);
+
+    // Use the next smaller tabulated df, which is conservative
+    int index = 0;
+    while (index + 1 < count && dfs[index + 1] <= df)
+    {
+        index++;
+    }
+    return table[index];
+}
+
+std::vector<WorkloadComparison> Benchmark::compare(const std::vector<WorkloadResult> &baseline,
+                                                   const std::vector<WorkloadResult> &current,
+                                                   const RegressionThresholds &thresholds)
+{
+    std::map<std::string, WorkloadComparison> byName;
+    std::map<std::string, const WorkloadResult *> baselineByName;
+
+    for (const auto &result : baseline)
+    {
+        baselineByName[result.name] = &result;
+
+        WorkloadComparison &comparison = byName[result.name];
+        comparison.name = result.name;
+        comparison.inBaseline = true;
+        comparison.baselineLatencyUs = result.meanLatency();
+        comparison.baselineExpansions = result.nodesExpanded;
+    }
+
+    for (const auto &result : current)
+    {
+        WorkloadComparison &comparison = byName[result.name];
+        comparison.name = result.name;
+        comparison.inCurrent = true;
+        comparison.currentLatencyUs = result.meanLatency();
+        comparison.currentExpansions = result.nodesExpanded;
+
+        if (!comparison.inBaseline)
+            continue;
+
+        const WorkloadResult *base = baselineByName[result.name];
+
+        // Latency: Welch's interval on the difference of the means
+        double baseMean = base->meanLatency();
+        double diff = comparison.currentLatencyUs - baseMean;
+        double n1 = static_cast<double>(base->latencyUs.size());
+        double n2 = static_cast<double>(result.latencyUs.size());
+        double v1 = n1 > 0 ? (base->latencyStdDev() * base->latencyStdDev()) / n1 : 0.0;
+        double v2 = n2 > 0 ? (result.latencyStdDev() * result.latencyStdDev()) / n2 : 0.0;
+        double stdErr = std::sqrt(v1 + v2);
+
+        double halfWidth = 0.0;
+        if (stdErr > 0.0)
+        {
+            double denom = 0.0;
+            if (n1 > 1)
+                denom += (v1 * v1) / (n1 - 1);
+            if (n2 > 1)
+                denom += (v2 * v2) / (n2 - 1);
+            double df = denom > 0.0 ? ((v1 + v2) * (v1 + v2)) / denom : 1.0;
+            halfWidth = tCritical(df, thresholds.confidence) * stdErr;
+        }
+
+        if (baseMean > 0.0)
+        {
+            comparison.latencyDeltaPct = 100.0 * diff / baseMean;
+            comparison.latencyCiPct = 100.0 * halfWidth / baseMean;
+        }
+        comparison.latencyRegressed = comparison.latencyDeltaPct > thresholds.latencyPct && diff - halfWidth > 0.0;
+
+        // Expansions: deterministic, compare directly
+        int baseExp = comparison.baselineExpansions;
+        int curExp = comparison.currentExpansions;
+        if (baseExp > 0)
+        {
+            comparison.expansionsDeltaPct = 100.0 * (curExp - baseExp) / baseExp;
+        }
+        else if (curExp > 0)
+        {
+            comparison.expansionsDeltaPct = 100.0;
+        }
+        comparison.expansionsRegressed = comparison.expansionsDeltaPct > thresholds.expansionsPct;
+    }
+
+    std::vector<WorkloadComparison> comparisons;
+    for (const auto &entry : byName)
+    {
+        comparisons.push_back(entry.second);
+    }
+    return comparisons;
+}
+
+int Benchmark::printComparison(const std::vector<WorkloadComparison> &comparisons)
+{
+    int regressions = 0;
+
+    std::cout << "\n=== Benchmark Comparison ===\n";
+    std::cout << std::left << std::setw(48) << "Workload" << std::right
+              << std::setw(12) << "Base(us)" << std::setw(12) << "New(us)"
+              << std::setw(18) << "Delta(%)" << std::setw(10) << "Exp" << std::setw(10) << "ExpNew"
+              << "  Status" << std::endl;
+
+    for (const auto &comparison : comparisons)
+    {
+        std::cout << std::left << std::setw(48) << comparison.name << std::right;
+
+        if (!comparison.inBaseline || !comparison.inCurrent)
+        {
+            std::cout << "  " << (comparison.inBaseline ? "MISSING in current run" : "NEW (no baseline)") << std::endl;
+            continue;
+        }
+
+        std::ostringstream delta;
+        delta << std::fixed << std::setprecision(1) << std::showpos << comparison.latencyDeltaPct
+              << std::noshowpos << " +/-" << comparison.latencyCiPct;
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(12) << comparison.baselineLatencyUs
+                  << std::setw(12) << comparison.currentLatencyUs
+                  << std::setw(18) << delta.str()
+                  << std::setw(10) << comparison.baselineExpansions
+                  << std::setw(10) << comparison.currentExpansions;
+
+        if (comparison.latencyRegressed || comparison.expansionsRegressed)
+        {
+            regressions++;
+            std::cout << "  REGRESSION";
+            if (comparison.latencyRegressed)
+                std::cout << " [latency]";
+            if (comparison.expansionsRegressed)
+                std::cout << " [expansions]";
+        }
+        else
+        {
+            std::cout << "  ok";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "\nRegressed workloads: " << regressions << std::endl;
+    return regressions;
+}
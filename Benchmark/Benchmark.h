@@ -0,0 +1,178 @@
+/**
+ * @file Benchmark.h
+ * @brief Benchmark corpus runner and noise-aware regression comparison - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the Benchmark library which runs the single-unit
+ * pathfinding algorithms over a corpus of battle maps, records per-workload
+ * latency samples and search effort, stores them as JSON result files and
+ * compares two result files with confidence-interval based thresholds.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Measurements collected for one (map, algorithm) workload
+ *
+ * Latency is sampled once per repetition; search effort is deterministic
+ * for a given map and algorithm so it is stored once.
+ */
+struct WorkloadResult
+{
+    std::string name;                  ///< Unique workload name ("<map>:<algorithm>")
+    std::vector<double> latencyUs;     ///< Latency of every repetition in microseconds
+    int nodesExpanded;                 ///< Nodes expanded by the search
+    int pathLength;                    ///< Path length found, or -1 if no path
+
+    /**
+     * @brief Default constructor initializing an empty result
+     */
+    WorkloadResult() : nodesExpanded(0), pathLength(-1) {}
+
+    /**
+     * @brief Mean latency over all repetitions
+     * @return Mean latency in microseconds, 0 if there are no samples
+     */
+    double meanLatency() const;
+
+    /**
+     * @brief Sample standard deviation of the latency
+     * @return Standard deviation in microseconds, 0 if fewer than two samples
+     */
+    double latencyStdDev() const;
+};
+
+/**
+ * @brief Outcome of comparing one workload against the baseline
+ */
+struct WorkloadComparison
+{
+    std::string name;           ///< Workload name
+    bool inBaseline;            ///< False if the workload is new
+    bool inCurrent;             ///< False if the workload disappeared
+    double baselineLatencyUs;   ///< Baseline mean latency
+    double currentLatencyUs;    ///< Current mean latency
+    double latencyDeltaPct;     ///< Relative latency change in percent
+    double latencyCiPct;        ///< Half-width of the delta confidence interval in percent
+    int baselineExpansions;     ///< Baseline nodes expanded
+    int currentExpansions;      ///< Current nodes expanded
+    double expansionsDeltaPct;  ///< Relative change in nodes expanded in percent
+    bool latencyRegressed;      ///< Latency regressed beyond threshold and noise
+    bool expansionsRegressed;   ///< Expansions regressed beyond threshold
+
+    /**
+     * @brief Default constructor initializing a neutral comparison
+     */
+    WorkloadComparison()
+        : inBaseline(false), inCurrent(false), baselineLatencyUs(0.0), currentLatencyUs(0.0),
+          latencyDeltaPct(0.0), latencyCiPct(0.0), baselineExpansions(0), currentExpansions(0),
+          expansionsDeltaPct(0.0), latencyRegressed(false), expansionsRegressed(false) {}
+};
+
+/**
+ * @brief Thresholds used by Benchmark::compare()
+ */
+struct RegressionThresholds
+{
+    double latencyPct;    ///< Allowed mean latency increase in percent
+    double expansionsPct; ///< Allowed nodes-expanded increase in percent
+    double confidence;    ///< Confidence level for the latency interval (0.90, 0.95 or 0.99)
+
+    /**
+     * @brief Default thresholds: 5% latency, 0% expansions, 95% confidence
+     */
+    RegressionThresholds() : latencyPct(5.0), expansionsPct(0.0), confidence(0.95) {}
+};
+
+/**
+ * @brief Benchmark corpus runner and result comparison
+ *
+ * Every map in the corpus is loaded once and each of the A*, BFS and DFS
+ * searches is run @p repetitions times between the map's default start and
+ * target. Results are written as JSON so a baseline can be committed or kept
+ * locally and compared against later runs.
+ *
+ * @par Usage Example:
+ * @code
+ * std::vector<WorkloadResult> results;
+ * Benchmark::runCorpus(Benchmark::collectCorpus({"samples"}), 30, results);
+ * Benchmark::saveResults("bench_current.json", results);
+ * @endcode
+ */
+class Benchmark
+{
+public:
+    /**
+     * @brief Expand files and directories into a sorted list of map files
+     * @param paths Map files or directories (searched recursively for *.json)
+     * @return Sorted list of map file paths
+     */
+    static std::vector<std::string> collectCorpus(const std::vector<std::string> &paths);
+
+    /**
+     * @brief Run all algorithms on every map of the corpus
+     * @param mapFiles Map files to benchmark
+     * @param repetitions Number of timed repetitions per workload
+     * @param results Output vector receiving one entry per workload
+     * @return true if every map loaded successfully
+     */
+    static bool runCorpus(const std::vector<std::string> &mapFiles, int repetitions,
+                          std::vector<WorkloadResult> &results);
+
+    /**
+     * @brief Save results to a JSON file
+     * @param filename Output file path
+     * @param results Results to save
+     * @return true on success
+     */
+    static bool saveResults(const std::string &filename, const std::vector<WorkloadResult> &results);
+
+    /**
+     * @brief Load results from a JSON file written by saveResults()
+     * @param filename Input file path
+     * @param results Output vector receiving the loaded results
+     * @return true on success
+     */
+    static bool loadResults(const std::string &filename, std::vector<WorkloadResult> &results);
+
+    /**
+     * @brief Compare current results against a baseline
+     * @param baseline Baseline results
+     * @param current Current results
+     * @param thresholds Regression thresholds
+     * @return One comparison per workload present in either result set
+     *
+     * Latency only counts as regressed when the mean increased by more than
+     * the threshold and the confidence interval of the difference (Welch)
+     * excludes zero, so noisy workloads with few repetitions do not fail the
+     * gate. Expansions are deterministic and use the threshold alone.
+     */
+    static std::vector<WorkloadComparison> compare(const std::vector<WorkloadResult> &baseline,
+                                                   const std::vector<WorkloadResult> &current,
+                                                   const RegressionThresholds &thresholds);
+
+    /**
+     * @brief Print a comparison table to console
+     * @param comparisons Comparisons returned by compare()
+     * @return Number of regressed workloads
+     */
+    static int printComparison(const std::vector<WorkloadComparison> &comparisons);
+
+    /**
+     * @brief Two-sided critical value of Student's t distribution
+     * @param degreesOfFreedom Degrees of freedom (values < 1 are treated as 1)
+     * @param confidence Confidence level (0.90, 0.95 or 0.99; others round to 0.95)
+     * @return Critical value t such that P(|T| <= t) = confidence
+     */
+    static double tCritical(double degreesOfFreedom, double confidence);
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,182 @@
+/**
+ * @file CompactPath.cpp
+ * @brief Compact path storage with 2- and 3-bit direction codes - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of CompactPath: codebook selection,
+ * bit packing of step codes and checkpoints, and sequential and random
+ * access decoding.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "CompactPath.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    // Step offsets per code: right, down, left, up, then wait (ORTHOGONAL_WAITS)
+    // or the diagonals down-right, down-left, up-left, up-right (OCTILE)
+    const int DX[2][8] = {{1, 0, -1, 0, 0, 0, 0, 0}, {1, 0, -1, 0, 1, -1, -1, 1}};
+    const int DY[2][8] = {{0, 1, 0, -1, 0, 0, 0, 0}, {0, 1, 0, -1, 1, 1, -1, -1}};
+
+    uint64_t packPosition(const Position &position)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(position.x)) << 32) | static_cast<uint32_t>(position.y);
+    }
+
+    Position unpackPosition(uint64_t packed)
+    {
+        return Position(static_cast<int>(static_cast<uint32_t>(packed >> 32)), static_cast<int>(static_cast<uint32_t>(packed)));
+    }
+
+    /**
+     * Code of a step in a codebook, or -1 if the codebook cannot express it
+     */
+    int codeFor(int dx, int dy, PathEncoding encoding)
+    {
+        int table = encoding == PathEncoding::OCTILE ? 1 : 0;
+        int codes = encoding == PathEncoding::ORTHOGONAL ? 4 : (encoding == PathEncoding::OCTILE ? 8 : 5);
+        for (int code = 0; code < codes; ++code)
+        {
+            if (DX[table][code] == dx && DY[table][code] == dy)
+                return code;
+        }
+        return -1;
+    }
+}
+
+const size_t CompactPath::CHECKPOINT_INTERVAL;
+
+CompactPath::CompactPath() : steps(0), encoding(PathEncoding::ORTHOGONAL), hasStart(false)
+{
+}
+
+void CompactPath::clear()
+{
+    steps = 0;
+    encoding = PathEncoding::ORTHOGONAL;
+    hasStart = false;
+    words.clear();
+    words.shrink_to_fit();
+}
+
+bool CompactPath::assign(const std::vector<Position> &path)
+{
+    clear();
+    if (path.empty())
+        return true;
+
+    // Smallest codebook that fits: waits and diagonals each need the 3-bit form
+    bool waits = false;
+    bool diagonals = false;
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        int dx = path[i].x - path[i - 1].x;
+        int dy = path[i].y - path[i - 1].y;
+        if (std::abs(dx) > 1 || std::abs(dy) > 1)
+            return false;
+        if (dx == 0 && dy == 0)
+            waits = true;
+        else if (dx != 0 && dy != 0)
+            diagonals = true;
+    }
+    if (waits && diagonals)
+        return false;
+
+    encoding = diagonals ? PathEncoding::OCTILE : (waits ? PathEncoding::ORTHOGONAL_WAITS : PathEncoding::ORTHOGONAL);
+    start = path.front();
+    finish = path.back();
+    steps = static_cast<uint32_t>(path.size() - 1);
+    hasStart = true;
+
+    int bits = bitsPerStep();
+    size_t checkpoints = (steps > 0 ? (steps - 1) / CHECKPOINT_INTERVAL : 0);
+    words.assign(codeWords() + checkpoints, 0);
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        uint64_t code = static_cast<uint64_t>(codeFor(path[i].x - path[i - 1].x, path[i].y - path[i - 1].y, encoding));
+        size_t bit = (i - 1) * bits;
+        words[bit >> 6] |= code << (bit & 63);
+        if ((bit & 63) + bits > 64)
+            words[(bit >> 6) + 1] |= code >> (64 - (bit & 63));
+    }
+
+    // Checkpoint k holds the position after k * CHECKPOINT_INTERVAL steps (k >= 1)
+    for (size_t k = 1; k <= checkpoints; ++k)
+    {
+        words[codeWords() + k - 1] = packPosition(path[k * CHECKPOINT_INTERVAL]);
+    }
+    return true;
+}
+
+int CompactPath::codeAt(size_t step) const
+{
+    int bits = bitsPerStep();
+    size_t bit = step * bits;
+    uint64_t value = words[bit >> 6] >> (bit & 63);
+    if ((bit & 63) + bits > 64)
+        value |= words[(bit >> 6) + 1] << (64 - (bit & 63));
+    return static_cast<int>(value & ((uint64_t(1) << bits) - 1));
+}
+
+void CompactPath::applyCode(int code, Position &position) const
+{
+    int table = encoding == PathEncoding::OCTILE ? 1 : 0;
+    position.x += DX[table][code];
+    position.y += DY[table][code];
+}
+
+std::vector<Position> CompactPath::toPositions() const
+{
+    std::vector<Position> path;
+    if (!hasStart)
+        return path;
+
+    path.reserve(size());
+    Position position = start;
+    path.push_back(position);
+    for (size_t step = 0; step < steps; ++step)
+    {
+        applyCode(codeAt(step), position);
+        path.push_back(position);
+    }
+    return path;
+}
+
+Position CompactPath::at(size_t index) const
+{
+    if (index >= steps)
+        return finish;
+
+    size_t checkpoint = index / CHECKPOINT_INTERVAL;
+    Position position = checkpoint == 0 ? start : unpackPosition(words[codeWords() + checkpoint - 1]);
+    size_t step = checkpoint * CHECKPOINT_INTERVAL;
+
+    if (encoding == PathEncoding::ORTHOGONAL)
+    {
+        // 32 codes per word, starting word-aligned at the checkpoint: count each
+        // direction with popcounts instead of stepping (r = 00, d = 01, l = 10, u = 11)
+        const uint64_t lowBits = 0x5555555555555555ULL;
+        for (; step < index; step += 32)
+        {
+            size_t count = std::min<size_t>(32, index - step);
+            uint64_t slots = count == 32 ? lowBits : lowBits & ((uint64_t(1) << (2 * count)) - 1);
+            uint64_t value = words[step / 32];
+            uint64_t low = value & slots;
+            uint64_t high = (value >> 1) & slots;
+            position.x += __builtin_popcountll(slots & ~low & ~high) - __builtin_popcountll(high & ~low);
+            position.y += __builtin_popcountll(low & ~high) - __builtin_popcountll(low & high);
+        }
+        return position;
+    }
+
+    for (; step < index; ++step)
+    {
+        applyCode(codeAt(step), position);
+    }
+    return position;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file CompactPath.h
+ * @brief Compact path storage with 2- and 3-bit direction codes - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines CompactPath, a space-efficient replacement for storing
+ * a std::vector<Position>: the start tile plus one 2-bit or 3-bit code per
+ * step, with periodic checkpoints for random access by step. It is meant for
+ * paths kept around for a long time, such as the stored paths of thousands
+ * of units.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef COMPACTPATH_H
+#define COMPACTPATH_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Codebook used for the steps of a CompactPath
+ */
+enum class PathEncoding : uint8_t
+{
+    ORTHOGONAL,       ///< 2 bits per step: right, down, left, up
+    ORTHOGONAL_WAITS, ///< 3 bits per step: right, down, left, up and wait (multi-unit paths)
+    OCTILE            ///< 3 bits per step: the 4 orthogonal and 4 diagonal moves
+};
+
+/**
+ * @brief Path stored as a start tile and packed direction codes
+ *
+ * assign() picks the smallest codebook that fits the path. Codes are packed
+ * LSB first into 64-bit words; the position after every CHECKPOINT_INTERVAL
+ * steps is stored after the codes, so at() decodes at most
+ * CHECKPOINT_INTERVAL - 1 steps. Tile paths use about 2.25 bits per step
+ * (3.25 with waits or diagonals) instead of the 64 bits of a Position.
+ *
+ * @par Usage Example:
+ * @code
+ * CompactPath stored;
+ * if (stored.assign(unit.path))                  // About 28x smaller for long 4-connected paths
+ *     unit.path.clear();
+ * Position next = stored.at(currentStep + 1);    // Random access by step
+ * std::vector<Position> path = stored.toPositions();
+ * @endcode
+ */
+class CompactPath
+{
+public:
+    static const size_t CHECKPOINT_INTERVAL = 256; ///< Steps between stored positions
+
+private:
+    Position start;              ///< First position (valid unless empty)
+    Position finish;             ///< Last position (valid unless empty)
+    uint32_t steps;              ///< Number of steps (positions - 1)
+    PathEncoding encoding;       ///< Codebook of the steps
+    bool hasStart;               ///< false for an empty path
+    std::vector<uint64_t> words; ///< Packed codes, then one packed position per checkpoint
+
+    /**
+     * @brief Bits per step of the current codebook
+     */
+    int bitsPerStep() const { return encoding == PathEncoding::ORTHOGONAL ? 2 : 3; }
+
+    /**
+     * @brief Number of words holding codes (checkpoints follow them)
+     */
+    size_t codeWords() const { return (static_cast<size_t>(steps) * bitsPerStep() + 63) / 64; }
+
+    /**
+     * @brief Read the code of one step
+     */
+    int codeAt(size_t step) const;
+
+    /**
+     * @brief Apply a code to a position
+     */
+    void applyCode(int code, Position &position) const;
+
+public:
+    /**
+     * @brief Create an empty path
+     */
+    CompactPath();
+
+    /**
+     * @brief Encode a path
+     * @param path Positions where consecutive entries are equal (a wait) or 4- or 8-neighbors
+     * @return false if a step is longer than one tile, or the path has both waits and
+     *         diagonal moves; the compact path is then left empty
+     */
+    bool assign(const std::vector<Position> &path);
+
+    /**
+     * @brief Decode the whole path
+     * @return The positions passed to assign()
+     */
+    std::vector<Position> toPositions() const;
+
+    /**
+     * @brief Get the position after a number of steps
+     * @param index Step index in [0, size())
+     * @return Position at that index
+     */
+    Position at(size_t index) const;
+
+    /**
+     * @brief Get the number of positions (0 for an empty path)
+     */
+    size_t size() const { return hasStart ? static_cast<size_t>(steps) + 1 : 0; }
+
+    /**
+     * @brief Check whether the path has no positions
+     */
+    bool empty() const { return !hasStart; }
+
+    /**
+     * @brief Get the first position (requires a non-empty path)
+     */
+    const Position &front() const { return start; }
+
+    /**
+     * @brief Get the last position (requires a non-empty path)
+     */
+    const Position &back() const { return finish; }
+
+    /**
+     * @brief Get the codebook chosen by assign()
+     */
+    PathEncoding getEncoding() const { return encoding; }
+
+    /**
+     * @brief Get the bytes used by this object and its heap storage
+     */
+    size_t memoryBytes() const { return sizeof(CompactPath) + words.capacity() * sizeof(uint64_t); }
+
+    /**
+     * @brief Remove all positions
+     */
+    void clear();
+};
+
+#endif // COMPACTPATH_H
@@ -0,0 +1,268 @@
+/**
+ * @file DeadEndPruning.cpp
+ * @brief Dead-end and swamp detection for pruning A* and BFS - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of DeadEndPruning: the iterative
+ * articulation point search that finds dead ends and their preorder
+ * intervals, and the doorway scan that finds swamps.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "DeadEndPruning.h"
+#include <algorithm>
+
+namespace
+{
+    const int DX[4] = {1, 0, -1, 0};
+    const int DY[4] = {0, 1, 0, -1};
+}
+
+DeadEndPruning::DeadEndPruning(const PathFinder &engine)
+    : pathfinder(engine), built(false), builtVersion(0), width(0), height(0)
+{
+}
+
+bool DeadEndPruning::build(int maxDoorWidth, int maxSwampTiles)
+{
+    built = false;
+    stats = PruningStats();
+    if (!pathfinder.isMapLoaded())
+        return false;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    height = map.height;
+
+    findDeadEnds();
+    findSwamps(maxDoorWidth, maxSwampTiles);
+
+    builtVersion = pathfinder.getMapVersion();
+    built = true;
+    return true;
+}
+
+void DeadEndPruning::findDeadEnds()
+{
+    const BattleMap &map = pathfinder.getBattleMap();
+    size_t tileCount = static_cast<size_t>(width) * height;
+    preorder.assign(tileCount, -1);
+    subtreeEnd.assign(tileCount, -1);
+    deadEndRoot.assign(tileCount, -1);
+
+    std::vector<int> low(tileCount, 0);
+    std::vector<int> treeParent(tileCount, -1);
+    std::vector<uint8_t> cutOff(tileCount, 0); // Subtree separated from its parent's side by the parent
+    std::vector<int> order;                    // Tiles in preorder
+    order.reserve(tileCount);
+
+    // Explicit stack: recursion would overflow on long corridors
+    std::vector<std::pair<int, int>> stack; // (tile, next direction)
+    int counter = 0;
+    for (int root = 0; root < static_cast<int>(tileCount); ++root)
+    {
+        if (preorder[root] >= 0 || !map.isReachable(root % width, root / width))
+            continue;
+
+        preorder[root] = low[root] = counter++;
+        order.push_back(root);
+        stack.push_back(std::make_pair(root, 0));
+        while (!stack.empty())
+        {
+            int current = stack.back().first;
+            int direction = stack.back().second;
+            if (direction < 4)
+            {
+                stack.back().second++;
+                int nx = current % width + DX[direction];
+                int ny = current / width + DY[direction];
+                if (!map.isReachable(nx, ny))
+                    continue;
+
+                int neighbor = ny * width + nx;
+                if (preorder[neighbor] < 0)
+                {
+                    treeParent[neighbor] = current;
+                    preorder[neighbor] = low[neighbor] = counter++;
+                    order.push_back(neighbor);
+                    stack.push_back(std::make_pair(neighbor, 0));
+                }
+                else if (neighbor != treeParent[current])
+                {
+                    low[current] = std::min(low[current], preorder[neighbor]);
+                }
+                continue;
+            }
+
+            stack.pop_back();
+            subtreeEnd[current] = counter;
+            int up = treeParent[current];
+            if (up >= 0)
+            {
+                low[up] = std::min(low[up], low[current]);
+                if (low[current] >= preorder[up])
+                    cutOff[current] = 1; // No back edge past the parent: the parent is the only entrance
+            }
+        }
+    }
+
+    // Innermost dead end per tile: its own subtree if cut off, else its parent's
+    for (int index : order)
+    {
+        int up = treeParent[index];
+        deadEndRoot[index] = cutOff[index] ? index : (up >= 0 ? deadEndRoot[up] : -1);
+        if (cutOff[index])
+            stats.deadEnds++;
+        if (deadEndRoot[index] >= 0)
+            stats.deadEndTiles++;
+    }
+}
+
+void DeadEndPruning::findSwamps(int maxDoorWidth, int maxSwampTiles)
+{
+    const BattleMap &map = pathfinder.getBattleMap();
+    size_t tileCount = static_cast<size_t>(width) * height;
+    swampOf.assign(tileCount, -1);
+    if (maxDoorWidth < 2 || maxSwampTiles < 1)
+        return;
+
+    std::vector<SwampCandidate> candidates;
+    std::vector<uint32_t> visited(tileCount, 0);
+    uint32_t visitId = 0;
+    std::vector<int> queue;
+
+    // Flood the side (sideX, sideY) of a doorway without crossing it; a pocket
+    // that runs out of tiles before the size limit only exits through the door
+    auto explore = [&](const std::vector<int> &door, int sideX, int sideY)
+    {
+        ++visitId;
+        queue.clear();
+        for (int index : door)
+        {
+            visited[index] = visitId;
+        }
+        for (int index : door)
+        {
+            int nx = index % width + sideX;
+            int ny = index / width + sideY;
+            if (map.isReachable(nx, ny) && visited[ny * width + nx] != visitId)
+            {
+                visited[ny * width + nx] = visitId;
+                queue.push_back(ny * width + nx);
+            }
+        }
+
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            if (queue.size() > static_cast<size_t>(maxSwampTiles))
+                return;
+            int current = queue[head];
+            for (int direction = 0; direction < 4; ++direction)
+            {
+                int nx = current % width + DX[direction];
+                int ny = current / width + DY[direction];
+                if (map.isReachable(nx, ny) && visited[ny * width + nx] != visitId)
+                {
+                    visited[ny * width + nx] = visitId;
+                    queue.push_back(ny * width + nx);
+                }
+            }
+        }
+
+        if (!queue.empty() && queue.size() <= static_cast<size_t>(maxSwampTiles))
+        {
+            SwampCandidate candidate;
+            candidate.tiles = queue;
+            candidate.door = door;
+            candidates.push_back(candidate);
+        }
+    };
+
+    // Doorways: maximal horizontal or vertical runs of 2..maxDoorWidth tiles between walls
+    std::vector<int> door;
+    for (int vertical = 0; vertical < 2; ++vertical)
+    {
+        int lines = vertical ? width : height;
+        int length = vertical ? height : width;
+        for (int line = 0; line < lines; ++line)
+        {
+            auto tileAt = [&](int offset)
+            {
+                return vertical ? offset * width + line : line * width + offset;
+            };
+            auto open = [&](int offset)
+            {
+                return vertical ? map.isReachable(line, offset) : map.isReachable(offset, line);
+            };
+
+            int along = 0;
+            while (along < length)
+            {
+                if (!open(along))
+                {
+                    along++;
+                    continue;
+                }
+
+                int runStart = along;
+                while (along < length && open(along))
+                    along++;
+                if (along - runStart < 2 || along - runStart > maxDoorWidth)
+                    continue;
+
+                door.clear();
+                for (int offset = runStart; offset < along; ++offset)
+                {
+                    door.push_back(tileAt(offset));
+                }
+                explore(door, vertical ? -1 : 0, vertical ? 0 : -1);
+                explore(door, vertical ? 1 : 0, vertical ? 0 : 1);
+            }
+        }
+    }
+
+    // Keep large pockets first; a pocket is skipped if it overlaps an accepted
+    // swamp or door, or if its own door lies inside an accepted swamp
+    std::vector<size_t> bySize(candidates.size());
+    for (size_t i = 0; i < bySize.size(); ++i)
+    {
+        bySize[i] = i;
+    }
+    std::stable_sort(bySize.begin(), bySize.end(), [&](size_t a, size_t b)
+                     { return candidates[a].tiles.size() > candidates[b].tiles.size(); });
+
+    std::vector<uint8_t> isDoor(tileCount, 0);
+    for (size_t candidateIndex : bySize)
+    {
+        const SwampCandidate &candidate = candidates[candidateIndex];
+        bool free = true;
+        for (int index : candidate.tiles)
+        {
+            if (swampOf[index] >= 0 || isDoor[index])
+            {
+                free = false;
+                break;
+            }
+        }
+        for (size_t i = 0; free && i < candidate.door.size(); ++i)
+        {
+            free = swampOf[candidate.door[i]] < 0;
+        }
+        if (!free)
+            continue;
+
+        int id = static_cast<int>(stats.swamps++);
+        for (int index : candidate.tiles)
+        {
+            swampOf[index] = id;
+        }
+        for (int index : candidate.door)
+        {
+            isDoor[index] = 1;
+        }
+        stats.swampTiles += candidate.tiles.size();
+    }
+}
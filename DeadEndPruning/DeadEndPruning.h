@@ -0,0 +1,167 @@
+/**
+ * @file DeadEndPruning.h
+ * @brief Dead-end and swamp detection for pruning A* and BFS - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines DeadEndPruning, a preprocessing pass that finds the
+ * parts of a map no shortest path needs to enter: dead ends (regions joined
+ * to the rest through a single tile) and swamps (pockets whose only opening
+ * is one straight doorway). PathFinder::setPruning() lets findPathAStar()
+ * and findPathBFS() skip them unless they hold the start or the target.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef DEADENDPRUNING_H
+#define DEADENDPRUNING_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Counters describing the regions found by the last build
+ */
+struct PruningStats
+{
+    size_t deadEnds;     ///< Regions joined to the rest of the map through one tile
+    size_t deadEndTiles; ///< Tiles inside at least one dead end
+    size_t swamps;       ///< Pockets opening onto a single straight doorway
+    size_t swampTiles;   ///< Tiles inside a swamp
+
+    /**
+     * @brief Default constructor initializing all counters to zero
+     */
+    PruningStats() : deadEnds(0), deadEndTiles(0), swamps(0), swampTiles(0) {}
+};
+
+/**
+ * @brief Exact region pruning for searches with a known start and target
+ *
+ * @par Dead ends:
+ * A depth-first search over the reachable tiles finds every tile v whose
+ * removal cuts off a DFS subtree (Tarjan's articulation points). A simple path
+ * that enters such a subtree from outside must leave through v again, so no
+ * shortest path visits it unless the start or target lies inside. Subtrees are
+ * contiguous in DFS preorder, which turns "does this dead end hold the start?"
+ * into an interval test.
+ *
+ * @par Swamps:
+ * A swamp is a pocket of at most maxSwampTiles tiles whose only exits are the
+ * tiles of one straight doorway, a run of 2 to maxDoorWidth reachable tiles
+ * between two walls. Walking along the doorway is never longer than a detour
+ * through the pocket, so the pocket can be skipped. Swamps are disjoint and no
+ * doorway lies inside another swamp, which keeps all of them prunable at once.
+ *
+ * Pruning never changes the path length; it only removes tiles the search
+ * would otherwise expand. It implements the SearchPruner interface that
+ * PathFinder::setPruning() takes. One built instance can be shared by any
+ * number of PathFinder copies of the same map, including from several
+ * threads.
+ *
+ * @par Usage Example:
+ * @code
+ * DeadEndPruning pruning(pathfinder);
+ * pruning.build();
+ * pathfinder.setPruning(&pruning);
+ * std::vector<Position> path = pathfinder.findPathAStar(start, target); // Same length, fewer expansions
+ * @endcode
+ *
+ * @warning The regions describe the terrain at build time. After
+ *          PathFinder::setTile() or a reload the engine ignores them until
+ *          build() is called again.
+ */
+class DeadEndPruning : public SearchPruner
+{
+private:
+    const PathFinder &pathfinder; ///< Engine providing the map
+    bool built;                   ///< true once build() succeeded
+    uint64_t builtVersion;        ///< Map version the regions describe
+    int width;                    ///< Map width the regions describe
+    int height;                   ///< Map height the regions describe
+    PruningStats stats;           ///< Counters of the last build
+
+    std::vector<int> preorder;    ///< DFS preorder number per tile (-1 = unreachable)
+    std::vector<int> subtreeEnd;  ///< One past the last preorder number of the tile's DFS subtree
+    std::vector<int> deadEndRoot; ///< Innermost dead end containing the tile, as its root tile (-1 = none)
+    std::vector<int> swampOf;     ///< Swamp id per tile (-1 = none)
+
+    /**
+     * @brief Candidate pocket behind one doorway
+     */
+    struct SwampCandidate
+    {
+        std::vector<int> tiles; ///< Pocket tiles
+        std::vector<int> door;  ///< Doorway tiles
+    };
+
+    /**
+     * @brief Find dead ends with an iterative articulation point search
+     */
+    void findDeadEnds();
+
+    /**
+     * @brief Find swamps behind straight doorways and keep a disjoint subset
+     * @param maxDoorWidth Widest doorway considered
+     * @param maxSwampTiles Largest pocket considered
+     */
+    void findSwamps(int maxDoorWidth, int maxSwampTiles);
+
+    /**
+     * @brief Check whether the dead end rooted at a tile contains another tile
+     */
+    bool deadEndContains(int root, int index) const
+    {
+        return index >= 0 && preorder[index] >= preorder[root] && preorder[index] < subtreeEnd[root];
+    }
+
+public:
+    /**
+     * @brief Create an empty pruning over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit DeadEndPruning(const PathFinder &engine);
+
+    /**
+     * @brief Find dead ends and swamps on the engine's current map
+     * @param maxDoorWidth Widest doorway considered for swamps (at least 2; smaller disables swamps)
+     * @param maxSwampTiles Largest pocket accepted as a swamp
+     * @return false if no map is loaded
+     */
+    bool build(int maxDoorWidth = 4, int maxSwampTiles = 256);
+
+    /**
+     * @brief Check whether the regions describe an engine's current map
+     * @param engine The engine used for build() or a copy of it
+     */
+    bool isCurrentFor(const PathFinder &engine) const override
+    {
+        const BattleMap &map = engine.getBattleMap();
+        return built && engine.getMapVersion() == builtVersion && map.width == width && map.height == height;
+    }
+
+    /**
+     * @brief Check whether a search from start to target may skip a tile
+     * @param index Tile index (y * width + x)
+     * @param startIndex Start tile index
+     * @param targetIndex Target tile index
+     * @return true if no shortest path between start and target needs the tile
+     */
+    bool isPruned(int index, int startIndex, int targetIndex) const override
+    {
+        int root = deadEndRoot[index];
+        if (root >= 0 && !deadEndContains(root, startIndex) && !deadEndContains(root, targetIndex))
+            return true;
+        int swamp = swampOf[index];
+        return swamp >= 0 && swamp != swampOf[startIndex] && swamp != swampOf[targetIndex];
+    }
+
+    /**
+     * @brief Get the counters of the last build
+     */
+    const PruningStats &getStats() const { return stats; }
+};
+
+#endif // DEADENDPRUNING_H
@@ -0,0 +1,220 @@
+/**
+ * @file GoalSetSearch.cpp
+ * @brief Multi-goal search to the nearest of a set of goal tiles - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of GoalSet and GoalSetSearch: A* to
+ * the bounding box of a goal mask, breadth-first search to a predicate, and
+ * the attack-position goal sets built from a range and line of sight.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "GoalSetSearch.h"
+#include "../Visibility/Visibility.h"
+#include <algorithm>
+#include <cstdlib>
+
+void GoalSet::add(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return;
+    uint8_t &goal = mask[static_cast<size_t>(y) * width + x];
+    if (goal)
+        return;
+    goal = 1;
+    goalCount++;
+    left = std::min(left, x);
+    top = std::min(top, y);
+    right = std::max(right, x);
+    bottom = std::max(bottom, y);
+}
+
+GoalSetSearch::GoalSetSearch(const PathFinder &engine)
+    : pathfinder(engine), width(0), searchId(0), lastGoal(-1, -1)
+{
+}
+
+int GoalSetSearch::beginSearch(const Position &start)
+{
+    lastSearchStats = SearchStats();
+    lastGoal = Position(-1, -1);
+    if (!pathfinder.isMapLoaded())
+        return -1;
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y))
+        return -1;
+
+    size_t tileCount = static_cast<size_t>(map.width) * map.height;
+    if (stamp.size() != tileCount || width != map.width)
+    {
+        width = map.width;
+        gCost.assign(tileCount, 0);
+        parent.assign(tileCount, -1);
+        stamp.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+    return start.y * width + start.x;
+}
+
+std::vector<Position> GoalSetSearch::finishPath(int goalIndex)
+{
+    std::vector<Position> path;
+    for (int index = goalIndex; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    std::reverse(path.begin(), path.end());
+    lastGoal = path.back();
+    lastSearchStats.pathCost = static_cast<int>(path.size()) - 1;
+    return path;
+}
+
+std::vector<Position> GoalSetSearch::findPath(const Position &start, const GoalSet &goals)
+{
+    int startIndex = beginSearch(start);
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (startIndex < 0 || goals.empty() || goals.width != map.width || goals.height != map.height)
+        return {};
+
+    // Manhattan distance to the goals' bounding box
+    auto heuristic = [&](int x, int y)
+    {
+        int dx = std::max(0, std::max(goals.left - x, x - goals.right));
+        int dy = std::max(0, std::max(goals.top - y, y - goals.bottom));
+        return dx + dy;
+    };
+    auto push = [&](int index, int from, int cost)
+    {
+        if (stamp[index] != searchId)
+        {
+            stamp[index] = searchId;
+            closed[index] = 0;
+        }
+        else if (closed[index] || gCost[index] <= cost)
+        {
+            return;
+        }
+        gCost[index] = cost;
+        parent[index] = from;
+        OpenEntry entry = {cost + heuristic(index % width, index / width), cost, index};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        lastSearchStats.nodesGenerated++;
+    };
+
+    open.clear();
+    push(startIndex, -1, 0);
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.index;
+        if (closed[current] || entry.g != gCost[current])
+            continue;
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        if (goals.mask[current])
+            return finishPath(current);
+
+        int x = current % width;
+        int y = current / width;
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (map.isReachable(nx, ny))
+                push(ny * width + nx, current, entry.g + 1);
+        }
+    }
+    return {};
+}
+
+std::vector<Position> GoalSetSearch::findPath(const Position &start,
+                                              const std::function<bool(const Position &)> &isGoal)
+{
+    int startIndex = beginSearch(start);
+    if (startIndex < 0)
+        return {};
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+    queue.clear();
+    queue.push_back(startIndex);
+    stamp[startIndex] = searchId;
+    parent[startIndex] = -1;
+    lastSearchStats.nodesGenerated = 1;
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        int current = queue[head];
+        int x = current % width;
+        int y = current / width;
+        lastSearchStats.nodesExpanded++;
+        if (isGoal(Position(x, y)))
+            return finishPath(current);
+
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+            int neighbor = ny * width + nx;
+            if (stamp[neighbor] == searchId)
+                continue;
+            stamp[neighbor] = searchId;
+            parent[neighbor] = current;
+            queue.push_back(neighbor);
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+    return {};
+}
+
+GoalSet GoalSetSearch::attackPositions(const Position &target, int range, Visibility *sight) const
+{
+    if (!pathfinder.isMapLoaded())
+        return GoalSet();
+    const BattleMap &map = pathfinder.getBattleMap();
+    GoalSet goals(map.width, map.height);
+    if (range < 1 || !map.isValidPosition(target.x, target.y))
+        return goals;
+
+    // The target's own field: symmetric shadowcasting makes it the set of tiles that see the target
+    std::shared_ptr<const VisibilityField> field;
+    if (sight)
+        field = sight->fieldFrom(target);
+
+    long long rangeSquared = static_cast<long long>(range) * range;
+    for (int y = std::max(0, target.y - range); y <= std::min(map.height - 1, target.y + range); ++y)
+    {
+        for (int x = std::max(0, target.x - range); x <= std::min(map.width - 1, target.x + range); ++x)
+        {
+            long long dx = x - target.x;
+            long long dy = y - target.y;
+            if ((dx == 0 && dy == 0) || dx * dx + dy * dy > rangeSquared || !map.isReachable(x, y))
+                continue;
+            if (field && !field->contains(x, y))
+                continue;
+            goals.add(x, y);
+        }
+    }
+    return goals;
+}
+
+std::vector<Position> GoalSetSearch::findAttackPath(const Position &start, const Position &target, int range,
+                                                    Visibility *sight)
+{
+    return findPath(start, attackPositions(target, range, sight));
+}
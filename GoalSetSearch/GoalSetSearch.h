@@ -0,0 +1,204 @@
+/**
+ * @file GoalSetSearch.h
+ * @brief Multi-goal search to the nearest of a set of goal tiles - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines GoalSet, a bitmask of goal tiles with its bounding
+ * box, and GoalSetSearch, which finds the shortest path from a start tile to
+ * whichever goal is closest in one search. The typical use is moving a unit
+ * to any tile it can attack a target from, rather than to the target itself.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef GOALSETSEARCH_H
+#define GOALSETSEARCH_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+class Visibility;
+
+/**
+ * @brief Set of goal tiles over a map, with its bounding box
+ */
+struct GoalSet
+{
+    int width;                 ///< Map width the mask covers
+    int height;                ///< Map height the mask covers
+    int left;                  ///< Smallest goal x (meaningless while empty)
+    int top;                   ///< Smallest goal y
+    int right;                 ///< Largest goal x
+    int bottom;                ///< Largest goal y
+    size_t goalCount;          ///< Number of goal tiles
+    std::vector<uint8_t> mask; ///< 1 per goal tile, row-major
+
+    /**
+     * @brief Default constructor creating an empty set over no map
+     */
+    GoalSet() : width(0), height(0), left(0), top(0), right(-1), bottom(-1), goalCount(0) {}
+
+    /**
+     * @brief Create an empty set over a map
+     * @param mapWidth Map width
+     * @param mapHeight Map height
+     */
+    GoalSet(int mapWidth, int mapHeight)
+        : width(mapWidth), height(mapHeight), left(mapWidth), top(mapHeight), right(-1), bottom(-1), goalCount(0),
+          mask(static_cast<size_t>(mapWidth) * mapHeight, 0)
+    {
+    }
+
+    /**
+     * @brief Add a goal tile (ignored outside the map)
+     */
+    void add(int x, int y);
+
+    /**
+     * @brief Check whether a tile is a goal
+     */
+    bool contains(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return false;
+        return mask[static_cast<size_t>(y) * width + x] != 0;
+    }
+
+    /**
+     * @brief Check whether the set has no goals
+     */
+    bool empty() const { return goalCount == 0; }
+};
+
+/**
+ * @brief Shortest path from a start tile to the nearest goal of a set
+ *
+ * With a GoalSet, the search is A* whose heuristic is the Manhattan distance
+ * from a tile to the goals' bounding box. That never overestimates the
+ * distance to the nearest goal and is consistent, so the first goal expanded
+ * is a nearest one, and every tile is expanded at most once. With a
+ * predicate, no bounding box is known and the search is a breadth-first
+ * search that asks the predicate only about the tiles it dequeues.
+ *
+ * Moves are 4-connected in the PathFinder's move order, with unit cost, as
+ * in PathFinder::findPathAStar(). Either way one search replaces one A* run
+ * per candidate tile.
+ *
+ * @par Usage Example:
+ * @code
+ * GoalSetSearch search(pathfinder);
+ * Visibility sight(pathfinder, 8);
+ * std::vector<Position> path = search.findAttackPath(unit, enemy, 6, &sight);   // Range 6 with line of sight
+ * Position firingSpot = search.getLastGoal();
+ * path = search.findPath(unit, [&](const Position &p) { return isCover(p); });
+ * @endcode
+ *
+ * @note Queries on one instance are not thread safe.
+ */
+class GoalSetSearch
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int g;     ///< Cost from the start, higher wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing map and move order
+    int width;                    ///< Map width of the buffers
+
+    std::vector<int> gCost;      ///< Cost per tile, valid where stamp matches
+    std::vector<int> parent;     ///< Parent tile per tile (-1 for the start)
+    std::vector<uint32_t> stamp; ///< Search id that last touched each tile
+    std::vector<uint8_t> closed; ///< Expanded flag, valid where stamp matches
+    std::vector<OpenEntry> open; ///< Binary heap of open entries
+    std::vector<int> queue;      ///< FIFO of the predicate search
+    uint32_t searchId;           ///< Current search id
+    SearchStats lastSearchStats; ///< Effort of the last search
+    Position lastGoal;           ///< Goal reached by the last search, (-1,-1) if none
+
+    /**
+     * @brief Reset the stats and start a new search id
+     * @return Start tile index, or -1 if no map is loaded or the start is not reachable
+     */
+    int beginSearch(const Position &start);
+
+    /**
+     * @brief Build the path ending at a tile from the parent links
+     */
+    std::vector<Position> finishPath(int goalIndex);
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit GoalSetSearch(const PathFinder &engine);
+
+    /**
+     * @brief Find the shortest path to the nearest tile of a goal set
+     * @param start Start position
+     * @param goals Goal tiles over the current map
+     * @return Path from start to the nearest reachable goal (both included), empty if none is reachable
+     */
+    std::vector<Position> findPath(const Position &start, const GoalSet &goals);
+
+    /**
+     * @brief Find the shortest path to the nearest tile accepted by a predicate
+     * @param start Start position
+     * @param isGoal Called once per dequeued tile, nearest tiles first
+     * @return Path from start to the nearest accepted tile (both included), empty if none is reachable
+     */
+    std::vector<Position> findPath(const Position &start, const std::function<bool(const Position &)> &isGoal);
+
+    /**
+     * @brief Collect the tiles a unit could attack a target from
+     * @param target Tile to attack
+     * @param range Attack range in tiles (Euclidean)
+     * @param sight If set, tiles must also see the target; the range is then capped at its sight radius
+     * @return Reachable tiles other than the target within range (and line of sight)
+     */
+    GoalSet attackPositions(const Position &target, int range, Visibility *sight = nullptr) const;
+
+    /**
+     * @brief Find the shortest path to the nearest tile a target can be attacked from
+     * @param start Start position
+     * @param target Tile to attack
+     * @param range Attack range in tiles (Euclidean)
+     * @param sight If set, the attack position must also see the target
+     * @return Path from start to the nearest attack position, empty if none is reachable
+     */
+    std::vector<Position> findAttackPath(const Position &start, const Position &target, int range,
+                                         Visibility *sight = nullptr);
+
+    /**
+     * @brief Get the goal reached by the last search, or (-1,-1) if none was reached
+     */
+    const Position &getLastGoal() const { return lastGoal; }
+
+    /**
+     * @brief Get search effort of the last search (pathCost is the number of moves)
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+};
+
+#endif // GOALSETSEARCH_H
@@ -0,0 +1,296 @@
+/**
+ * @file InfluenceMap.cpp
+ * @brief Tactical influence and threat maps from multi-source propagation - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of InfluenceMap: unit bookkeeping,
+ * the sorted-source multi-source propagation per group, and the pass that
+ * combines group planes into the influence and cost planes.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "InfluenceMap.h"
+#include "../TaskPool/TaskPool.h"
+#include <algorithm>
+
+namespace
+{
+    const int DX[4] = {1, 0, -1, 0};
+    const int DY[4] = {0, 1, 0, -1};
+
+    // Rows handed to one task when combining planes
+    const size_t ROW_GRAIN = 32;
+
+    // Largest extra cost a tile can get
+    const float MAX_TILE_COST = 65535.0f;
+}
+
+InfluenceMap::InfluenceMap(const PathFinder &engine, float decayPerMove, InfluenceCombine mode, float minInfluence)
+    : pathfinder(engine), decay(std::max(0.01f, std::min(decayPerMove, 0.99f))),
+      threshold(std::max(minInfluence, 1e-6f)), combine(mode), costScale(1.0f), builtVersion(0), built(false),
+      rebuildAll(true), width(0), height(0), lastRecomputedGroups(0)
+{
+}
+
+InfluenceMap::Group &InfluenceMap::groupAt(int group)
+{
+    size_t index = static_cast<size_t>(std::max(0, group));
+    if (index >= groups.size())
+        groups.resize(index + 1);
+    return groups[index];
+}
+
+int InfluenceMap::addUnit(const Position &position, float strength, int group)
+{
+    Source source;
+    source.position = position;
+    source.strength = strength;
+    source.group = std::max(0, group);
+    source.active = true;
+    int id = static_cast<int>(sources.size());
+    sources.push_back(source);
+
+    Group &owner = groupAt(source.group);
+    owner.members.push_back(id);
+    owner.dirty = true;
+    return id;
+}
+
+bool InfluenceMap::moveUnit(int id, const Position &position)
+{
+    if (id < 0 || id >= static_cast<int>(sources.size()) || !sources[id].active)
+        return false;
+    if (sources[id].position != position)
+    {
+        sources[id].position = position;
+        groups[sources[id].group].dirty = true;
+    }
+    return true;
+}
+
+bool InfluenceMap::setStrength(int id, float strength)
+{
+    if (id < 0 || id >= static_cast<int>(sources.size()) || !sources[id].active)
+        return false;
+    if (sources[id].strength != strength)
+    {
+        sources[id].strength = strength;
+        groups[sources[id].group].dirty = true;
+    }
+    return true;
+}
+
+bool InfluenceMap::removeUnit(int id)
+{
+    if (id < 0 || id >= static_cast<int>(sources.size()) || !sources[id].active)
+        return false;
+    sources[id].active = false;
+    Group &owner = groups[sources[id].group];
+    owner.members.erase(std::find(owner.members.begin(), owner.members.end(), id));
+    owner.dirty = true;
+    return true;
+}
+
+void InfluenceMap::setCostScale(float scale)
+{
+    costScale = std::max(0.0f, scale);
+    rebuildAll = true;
+}
+
+void InfluenceMap::propagate(Group &group, std::vector<int> &order, std::vector<int> &queue) const
+{
+    for (int index : group.touched)
+    {
+        group.plane[index] = 0.0f;
+    }
+    group.touched.clear();
+
+    // Sources on the map, strongest first
+    order.clear();
+    for (int id : group.members)
+    {
+        const Source &source = sources[id];
+        const Position &at = source.position;
+        if (source.strength >= threshold && at.x >= 0 && at.y >= 0 && at.x < width && at.y < height &&
+            passable[static_cast<size_t>(at.y) * width + at.x])
+            order.push_back(id);
+    }
+    if (order.empty())
+        return;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b)
+                     { return sources[a].strength > sources[b].strength; });
+
+    if (group.plane.empty())
+        group.plane.assign(static_cast<size_t>(width) * height, 0.0f);
+    std::vector<float> &plane = group.plane;
+    for (int id : order)
+    {
+        int index = sources[id].position.y * width + sources[id].position.x;
+        if (plane[index] == 0.0f)
+            group.touched.push_back(index);
+        plane[index] = std::max(plane[index], sources[id].strength);
+    }
+
+    // Propagated tiles enter the FIFO in order of decreasing influence, so
+    // merging it with the sorted sources settles every tile at its maximum
+    queue.clear();
+    size_t head = 0;
+    size_t nextSource = 0;
+    while (head < queue.size() || nextSource < order.size())
+    {
+        int current;
+        if (nextSource < order.size() &&
+            (head == queue.size() || sources[order[nextSource]].strength >= plane[queue[head]]))
+        {
+            const Source &source = sources[order[nextSource++]];
+            current = source.position.y * width + source.position.x;
+            if (plane[current] != source.strength)
+                continue; // A stronger source or a propagated value already holds this tile
+        }
+        else
+        {
+            current = queue[head++];
+        }
+
+        float spread = plane[current] * decay;
+        if (spread < threshold)
+            continue;
+        int x = current % width;
+        int y = current / width;
+        for (int direction = 0; direction < 4; ++direction)
+        {
+            int nx = x + DX[direction];
+            int ny = y + DY[direction];
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+                continue;
+            int neighbor = ny * width + nx;
+            if (!passable[neighbor] || plane[neighbor] >= spread)
+                continue;
+            if (plane[neighbor] == 0.0f)
+                group.touched.push_back(neighbor);
+            plane[neighbor] = spread;
+            queue.push_back(neighbor);
+        }
+    }
+}
+
+void InfluenceMap::combineRows(int firstRow, int endRow)
+{
+    const float *const *planes = activePlanes.data();
+    size_t planeCount = activePlanes.size();
+    bool sum = combine == InfluenceCombine::SUM;
+    float scale = costScale;
+
+    size_t end = static_cast<size_t>(endRow) * width;
+    for (size_t i = static_cast<size_t>(firstRow) * width; i < end; ++i)
+    {
+        if (!rebuildAll && !changed[i])
+            continue;
+        changed[i] = 0;
+
+        float value = 0.0f;
+        for (size_t p = 0; p < planeCount; ++p)
+        {
+            value = sum ? value + planes[p][i] : std::max(value, planes[p][i]);
+        }
+        influence[i] = value;
+        costs[i] = static_cast<uint16_t>(std::min(value * scale + 0.5f, MAX_TILE_COST));
+    }
+}
+
+bool InfluenceMap::update(int threads)
+{
+    if (!pathfinder.isMapLoaded())
+        return false;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!built || builtVersion != pathfinder.getMapVersion() || map.width != width || map.height != height)
+    {
+        width = map.width;
+        height = map.height;
+        size_t tileCount = static_cast<size_t>(width) * height;
+        passable.assign(tileCount, 0);
+        for (size_t index = 0; index < tileCount; ++index)
+        {
+            passable[index] = map.isReachable(static_cast<int>(index % width), static_cast<int>(index / width));
+        }
+        for (Group &group : groups)
+        {
+            group.plane.clear();
+            group.touched.clear();
+            group.dirty = true;
+        }
+        influence.assign(tileCount, 0.0f);
+        costs.assign(tileCount, 0);
+        changed.assign(tileCount, 0);
+        builtVersion = pathfinder.getMapVersion();
+        built = true;
+        rebuildAll = true;
+    }
+
+    // Tiles the dirty groups covered before are recombined along with their new ones
+    std::vector<Group *> dirty;
+    for (Group &group : groups)
+    {
+        if (!group.dirty)
+            continue;
+        dirty.push_back(&group);
+        for (int index : group.touched)
+        {
+            changed[index] = 1;
+        }
+    }
+    lastRecomputedGroups = dirty.size();
+
+    bool parallel = threads > 1;
+    if (parallel && dirty.size() > 1)
+    {
+        parallelFor(TaskPool::shared(), 0, dirty.size(), 1, threads, [&](size_t begin, size_t end)
+                    {
+                        std::vector<int> order;
+                        std::vector<int> queue;
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            propagate(*dirty[i], order, queue);
+                        } });
+    }
+    else
+    {
+        std::vector<int> order;
+        std::vector<int> queue;
+        for (Group *group : dirty)
+        {
+            propagate(*group, order, queue);
+        }
+    }
+
+    activePlanes.clear();
+    for (Group &group : groups)
+    {
+        group.dirty = false;
+        if (!group.touched.empty())
+            activePlanes.push_back(group.plane.data());
+    }
+    for (Group *group : dirty)
+    {
+        for (int index : group->touched)
+        {
+            changed[index] = 1;
+        }
+    }
+
+    if (parallel && height > static_cast<int>(ROW_GRAIN))
+    {
+        parallelFor(TaskPool::shared(), 0, static_cast<size_t>(height), ROW_GRAIN, threads, [&](size_t begin, size_t end)
+                    { combineRows(static_cast<int>(begin), static_cast<int>(end)); });
+    }
+    else
+    {
+        combineRows(0, height);
+    }
+    rebuildAll = false;
+    return true;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file InfluenceMap.h
+ * @brief Tactical influence and threat maps from multi-source propagation - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines InfluenceMap, which turns a set of units into a
+ * per-tile danger or control score. Each group of units spreads its strength
+ * through the walkable tiles with a multiplicative decay per move; the group
+ * planes are combined by sum or max and converted into an extra-cost plane
+ * that PathFinder::findPathWeightedAStar() can route around.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef INFLUENCEMAP_H
+#define INFLUENCEMAP_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief How the planes of different unit groups are combined
+ */
+enum class InfluenceCombine
+{
+    SUM, ///< Add the group planes (overlapping groups reinforce each other)
+    MAX  ///< Keep the strongest group per tile
+};
+
+/**
+ * @brief Per-tile influence of groups of units
+ *
+ * A unit of strength s adds s * decay^d to a tile d moves away (4-connected,
+ * around walls). Within a group the strongest contribution per tile wins,
+ * which is what a multi-source search computes in one pass: sources are
+ * sorted by strength and merged with a FIFO of propagated tiles, so tiles
+ * are settled in order of decreasing influence without a priority queue.
+ * Propagation stops where the influence falls below the threshold.
+ *
+ * Groups are the unit of incremental work. addUnit(), moveUnit() and
+ * removeUnit() only mark their group dirty; update() recomputes dirty groups
+ * (in parallel on the shared TaskPool) and then recombines the combined and
+ * cost planes only at tiles a dirty group covered before or covers now. A
+ * map edit or a new cost scale recombines every tile.
+ *
+ * @par Usage Example:
+ * @code
+ * InfluenceMap danger(pathfinder, 0.85f);
+ * for (const Unit &enemy : enemies)
+ *     ids.push_back(danger.addUnit(enemy.position, enemy.threat, enemy.squad));
+ * danger.setCostScale(20.0f);                      // Influence 1.0 costs 20 extra moves
+ * danger.update(4);                                // Up to 4 threads
+ * pathfinder.setTileCosts(&danger.getCostPlane());
+ * path = pathfinder.findPathWeightedAStar(start, target, 1.2);
+ * danger.moveUnit(ids[3], newPosition);            // Next tick: only that squad is recomputed
+ * danger.update(4);
+ * @endcode
+ *
+ * @note Not thread safe; update() parallelizes internally. The cost plane
+ *       keeps its address across updates, so it can stay attached to the
+ *       PathFinder.
+ */
+class InfluenceMap
+{
+private:
+    /**
+     * @brief One unit spreading influence
+     */
+    struct Source
+    {
+        Position position; ///< Current tile
+        float strength;    ///< Influence on its own tile
+        int group;         ///< Group the unit belongs to
+        bool active;       ///< false once removed
+    };
+
+    /**
+     * @brief Influence plane of one group, kept for incremental updates
+     */
+    struct Group
+    {
+        std::vector<float> plane; ///< Influence per tile, zero outside touched (empty until first used)
+        std::vector<int> touched; ///< Tiles with non-zero influence
+        std::vector<int> members; ///< Source ids of the group's units
+        bool dirty;               ///< true if members changed since the last update
+
+        /**
+         * @brief Default constructor creating an empty, dirty group
+         */
+        Group() : dirty(true) {}
+    };
+
+    const PathFinder &pathfinder;            ///< Engine providing the map
+    float decay;                             ///< Influence kept per move, in (0, 1)
+    float threshold;                         ///< Smallest influence propagated further
+    InfluenceCombine combine;                ///< How group planes are combined
+    float costScale;                         ///< Extra cost per unit of influence
+    uint64_t builtVersion;                   ///< Map version the planes describe
+    bool built;                              ///< true once update() succeeded
+    bool rebuildAll;                         ///< true if every tile must be recombined at the next update()
+    int width;                               ///< Map width of the planes
+    int height;                              ///< Map height of the planes
+    std::vector<uint8_t> passable;           ///< Reachable flag per tile
+    std::vector<Source> sources;             ///< All units ever added, indexed by id
+    std::vector<Group> groups;               ///< Group planes, indexed by group id
+    std::vector<float> influence;            ///< Combined influence per tile
+    std::vector<uint16_t> costs;             ///< Extra cost per tile for PathFinder::setTileCosts()
+    std::vector<uint8_t> changed;            ///< Tiles whose group values changed since the last combine
+    std::vector<const float *> activePlanes; ///< Planes of groups with influence, for combining
+    size_t lastRecomputedGroups;             ///< Groups recomputed by the last update()
+
+    /**
+     * @brief Get a group, creating it if needed
+     */
+    Group &groupAt(int group);
+
+    /**
+     * @brief Recompute one group's plane from its members
+     * @param group Group to recompute
+     * @param order Scratch buffer for sorted sources
+     * @param queue Scratch buffer for the propagation FIFO
+     */
+    void propagate(Group &group, std::vector<int> &order, std::vector<int> &queue) const;
+
+    /**
+     * @brief Recombine the changed tiles (or all tiles) of a range of rows
+     */
+    void combineRows(int firstRow, int endRow);
+
+public:
+    /**
+     * @brief Create an empty influence map over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     * @param decayPerMove Fraction of influence kept per move (clamped to [0.01, 0.99])
+     * @param mode How group planes are combined
+     * @param minInfluence Influence below which propagation stops
+     */
+    explicit InfluenceMap(const PathFinder &engine, float decayPerMove = 0.8f,
+                          InfluenceCombine mode = InfluenceCombine::SUM, float minInfluence = 0.01f);
+
+    /**
+     * @brief Add a unit
+     * @param position Tile the unit stands on
+     * @param strength Influence on its own tile (non-positive units spread nothing)
+     * @param group Group id (small non-negative integer); units that move together should share one
+     * @return Unit id for moveUnit() and removeUnit()
+     */
+    int addUnit(const Position &position, float strength, int group = 0);
+
+    /**
+     * @brief Move a unit to another tile
+     * @return false if the id is unknown or the unit was removed
+     */
+    bool moveUnit(int id, const Position &position);
+
+    /**
+     * @brief Change the strength of a unit (e.g. after damage)
+     * @return false if the id is unknown or the unit was removed
+     */
+    bool setStrength(int id, float strength);
+
+    /**
+     * @brief Remove a unit
+     * @return false if the id is unknown or the unit was already removed
+     */
+    bool removeUnit(int id);
+
+    /**
+     * @brief Set the extra move cost per unit of influence
+     * @param scale Extra cost of a tile is min(65535, round(scale * influence))
+     *
+     * Takes effect at the next update().
+     */
+    void setCostScale(float scale);
+
+    /**
+     * @brief Recompute dirty groups and rebuild the combined and cost planes
+     * @param threads Threads to use: 1 = the calling thread, otherwise up to this many shared TaskPool workers
+     * @return false if no map is loaded
+     */
+    bool update(int threads = 1);
+
+    /**
+     * @brief Get the combined influence of a tile (0 outside the map or before update())
+     */
+    float influenceAt(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height || influence.empty())
+            return 0.0f;
+        return influence[static_cast<size_t>(y) * width + x];
+    }
+
+    /**
+     * @brief Get the combined influence plane (row-major)
+     */
+    const std::vector<float> &getInfluence() const { return influence; }
+
+    /**
+     * @brief Get the extra-cost plane for PathFinder::setTileCosts() (row-major)
+     */
+    const std::vector<uint16_t> &getCostPlane() const { return costs; }
+
+    /**
+     * @brief Get the number of groups recomputed by the last update()
+     */
+    size_t getLastRecomputedGroups() const { return lastRecomputedGroups; }
+};
+
+#endif // INFLUENCEMAP_H
@@ -0,0 +1,235 @@
+/**
+ * @file MovementRange.cpp
+ * @brief Bounded movement-range queries on a packed bitboard - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of MovementRange: the packed
+ * reachability bitboard, window extraction, the word-parallel frontier
+ * expansion and batch evaluation on the shared TaskPool.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "MovementRange.h"
+#include "../TaskPool/TaskPool.h"
+#include <algorithm>
+
+namespace
+{
+    // Origins handed to one task in queryBatch()
+    const size_t TASK_GRAIN = 16;
+}
+
+const uint16_t RangeMask::UNREACHED;
+const int MovementRange::MAX_RADIUS;
+
+size_t RangeMask::count() const
+{
+    size_t tiles = 0;
+    for (uint64_t word : bits)
+    {
+        tiles += static_cast<size_t>(__builtin_popcountll(word));
+    }
+    return tiles;
+}
+
+std::vector<Position> RangeMask::tiles() const
+{
+    std::vector<Position> result;
+    result.reserve(count());
+    for (int y = 0; y < height; ++y)
+    {
+        for (int word = 0; word < wordsPerRow; ++word)
+        {
+            for (uint64_t value = bits[static_cast<size_t>(y) * wordsPerRow + word]; value; value &= value - 1)
+            {
+                result.push_back(Position(left + (word << 6) + __builtin_ctzll(value), top + y));
+            }
+        }
+    }
+    return result;
+}
+
+MovementRange::MovementRange(const PathFinder &engine)
+    : pathfinder(engine), planeVersion(0), planeBuilt(false), width(0), height(0), wordsPerRow(0)
+{
+}
+
+bool MovementRange::refreshPlane()
+{
+    if (!pathfinder.isMapLoaded())
+        return false;
+    if (planeBuilt && planeVersion == pathfinder.getMapVersion())
+        return true;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    height = map.height;
+    wordsPerRow = (width + 63) / 64;
+    plane.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    for (int y = 0; y < height; ++y)
+    {
+        uint64_t *row = &plane[static_cast<size_t>(y) * wordsPerRow];
+        for (int x = 0; x < width; ++x)
+        {
+            if (map.isReachable(x, y))
+                row[x >> 6] |= uint64_t(1) << (x & 63);
+        }
+    }
+
+    planeVersion = pathfinder.getMapVersion();
+    planeBuilt = true;
+    return true;
+}
+
+bool MovementRange::compute(const Position &origin, int radius, RangeMask &range) const
+{
+    range = RangeMask();
+    range.origin = origin;
+    if (origin.x < 0 || origin.y < 0 || origin.x >= width || origin.y >= height ||
+        !((plane[static_cast<size_t>(origin.y) * wordsPerRow + (origin.x >> 6)] >> (origin.x & 63)) & 1u))
+        return false;
+
+    radius = std::max(0, std::min(radius, MAX_RADIUS));
+    range.radius = radius;
+    range.left = std::max(0, origin.x - radius);
+    range.top = std::max(0, origin.y - radius);
+    range.width = std::min(width - 1, origin.x + radius) - range.left + 1;
+    range.height = std::min(height - 1, origin.y + radius) - range.top + 1;
+    range.wordsPerRow = (range.width + 63) / 64;
+
+    const int rows = range.height;
+    const int words = range.wordsPerRow;
+    const size_t cells = static_cast<size_t>(rows) * words;
+    uint64_t lastWordMask = (range.width & 63) ? (uint64_t(1) << (range.width & 63)) - 1 : ~uint64_t(0);
+
+    // Copy the window out of the bitboard, realigned so bit 0 is column left
+    std::vector<uint64_t> open(cells, 0);
+    int shift = range.left & 63;
+    for (int row = 0; row < rows; ++row)
+    {
+        const uint64_t *source = &plane[static_cast<size_t>(range.top + row) * wordsPerRow];
+        for (int word = 0; word < words; ++word)
+        {
+            int sourceWord = (range.left >> 6) + word;
+            uint64_t value = source[sourceWord] >> shift;
+            if (shift && sourceWord + 1 < wordsPerRow)
+                value |= source[sourceWord + 1] << (64 - shift);
+            if (word == words - 1)
+                value &= lastWordMask;
+            open[static_cast<size_t>(row) * words + word] = value;
+        }
+    }
+
+    std::vector<uint64_t> &reached = range.bits;
+    reached.assign(cells, 0);
+    range.distance.assign(static_cast<size_t>(rows) * range.width, RangeMask::UNREACHED);
+    std::vector<uint64_t> frontier(cells, 0);
+    std::vector<uint64_t> next(cells, 0);
+
+    int originX = origin.x - range.left;
+    int originY = origin.y - range.top;
+    size_t originWord = static_cast<size_t>(originY) * words + (originX >> 6);
+    reached[originWord] = frontier[originWord] = uint64_t(1) << (originX & 63);
+    range.distance[static_cast<size_t>(originY) * range.width + originX] = 0;
+
+    // Frontier rows outside [low, high] are stale and read as empty
+    int low = originY;
+    int high = originY;
+    auto frontierWord = [&](int row, int word) -> uint64_t
+    {
+        if (row < low || row > high || word < 0 || word >= words)
+            return 0;
+        return frontier[static_cast<size_t>(row) * words + word];
+    };
+
+    for (int moves = 1; moves <= radius; ++moves)
+    {
+        int nextLow = rows;
+        int nextHigh = -1;
+        for (int row = std::max(0, low - 1); row <= std::min(rows - 1, high + 1); ++row)
+        {
+            bool rowReached = false;
+            for (int word = 0; word < words; ++word)
+            {
+                uint64_t center = frontierWord(row, word);
+                uint64_t spread = center | (center << 1) | (center >> 1) |
+                                  (frontierWord(row, word - 1) >> 63) | (frontierWord(row, word + 1) << 63) |
+                                  frontierWord(row - 1, word) | frontierWord(row + 1, word);
+                size_t cell = static_cast<size_t>(row) * words + word;
+                next[cell] = spread & open[cell] & ~reached[cell];
+                rowReached |= next[cell] != 0;
+            }
+            if (rowReached)
+            {
+                nextLow = std::min(nextLow, row);
+                nextHigh = row;
+            }
+        }
+        if (nextHigh < 0)
+            break;
+
+        for (int row = nextLow; row <= nextHigh; ++row)
+        {
+            for (int word = 0; word < words; ++word)
+            {
+                size_t cell = static_cast<size_t>(row) * words + word;
+                reached[cell] |= next[cell];
+                for (uint64_t value = next[cell]; value; value &= value - 1)
+                {
+                    int x = (word << 6) + __builtin_ctzll(value);
+                    range.distance[static_cast<size_t>(row) * range.width + x] = static_cast<uint16_t>(moves);
+                }
+            }
+        }
+        frontier.swap(next);
+        low = nextLow;
+        high = nextHigh;
+    }
+
+    return true;
+}
+
+bool MovementRange::query(const Position &origin, int radius, RangeMask &range)
+{
+    if (!refreshPlane())
+    {
+        range = RangeMask();
+        range.origin = origin;
+        return false;
+    }
+    return compute(origin, radius, range);
+}
+
+std::vector<RangeMask> MovementRange::queryBatch(const std::vector<Position> &origins, int radius, int threads)
+{
+    std::vector<RangeMask> ranges(origins.size());
+    if (!refreshPlane())
+    {
+        for (size_t i = 0; i < origins.size(); ++i)
+        {
+            ranges[i].origin = origins[i];
+        }
+        return ranges;
+    }
+
+    if (threads > 1 && origins.size() > TASK_GRAIN)
+    {
+        parallelFor(TaskPool::shared(), 0, origins.size(), TASK_GRAIN, threads, [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            compute(origins[i], radius, ranges[i]);
+                        } });
+    }
+    else
+    {
+        for (size_t i = 0; i < origins.size(); ++i)
+        {
+            compute(origins[i], radius, ranges[i]);
+        }
+    }
+    return ranges;
+}
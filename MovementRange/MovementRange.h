@@ -0,0 +1,173 @@
+/**
+ * @file MovementRange.h
+ * @brief Bounded movement-range queries on a packed bitboard - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines MovementRange, which answers "which tiles can a unit
+ * reach within N moves" for the turn-based tactical mode. Each query is a
+ * breadth-first flood fill run on 64-bit words, one word covering 64 tiles
+ * of a row, and returns a bitset mask plus a distance plane limited to the
+ * query radius. Batches of queries share one bitboard and can run on the
+ * shared TaskPool.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef MOVEMENTRANGE_H
+#define MOVEMENTRANGE_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Tiles reachable from one origin within a radius
+ *
+ * Covers the window of the map that the radius can reach (clipped to the
+ * map). Bit (x - left) of row (y - top) is set for every reachable tile;
+ * rows are padded to whole 64-bit words.
+ */
+struct RangeMask
+{
+    static const uint16_t UNREACHED = 0xFFFF; ///< Distance of tiles outside the range
+
+    Position origin;                ///< Tile the range was computed from
+    int radius;                     ///< Maximum number of moves
+    int left;                       ///< Map x of the first window column
+    int top;                        ///< Map y of the first window row
+    int width;                      ///< Window width in tiles
+    int height;                     ///< Window height in tiles
+    int wordsPerRow;                ///< 64-bit words per window row
+    std::vector<uint64_t> bits;     ///< Reachable bit per window tile
+    std::vector<uint16_t> distance; ///< Moves from the origin per window tile, UNREACHED outside the range
+
+    /**
+     * @brief Default constructor creating an empty range
+     */
+    RangeMask() : radius(0), left(0), top(0), width(0), height(0), wordsPerRow(0) {}
+
+    /**
+     * @brief Check whether a map tile is in range
+     * @param x Map x-coordinate
+     * @param y Map y-coordinate
+     */
+    bool contains(int x, int y) const
+    {
+        x -= left;
+        y -= top;
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return false;
+        return (bits[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    /**
+     * @brief Get the number of moves to a map tile
+     * @param x Map x-coordinate
+     * @param y Map y-coordinate
+     * @return Moves from the origin, or -1 if the tile is out of range
+     */
+    int distanceTo(int x, int y) const
+    {
+        if (!contains(x, y))
+            return -1;
+        return distance[static_cast<size_t>(y - top) * width + (x - left)];
+    }
+
+    /**
+     * @brief Get the number of tiles in range (including the origin)
+     */
+    size_t count() const;
+
+    /**
+     * @brief List the tiles in range, row by row
+     */
+    std::vector<Position> tiles() const;
+};
+
+/**
+ * @brief Movement-range engine over a PathFinder's map
+ *
+ * The map is packed into a bitboard with one reachable bit per tile. A query
+ * copies the window around the origin out of it and grows the frontier one
+ * move at a time: shifting each row left and right and OR-ing the rows above
+ * and below moves 64 tiles per word operation. Moves are 4-connected, as in
+ * the rest of the engines, so the distance of a tile equals the length of
+ * its BFS path minus one.
+ *
+ * A query touches only the (2N + 1) x (2N + 1) window, so its cost depends
+ * on the radius and not on the map size.
+ *
+ * @par Usage Example:
+ * @code
+ * MovementRange ranges(pathfinder);
+ * RangeMask range;
+ * ranges.query(unit.position, 6, range);
+ * if (range.contains(x, y))
+ *     highlight(x, y, range.distanceTo(x, y));
+ * std::vector<RangeMask> all = ranges.queryBatch(unitPositions, 6, 4); // Up to 4 threads
+ * @endcode
+ *
+ * @note The bitboard is rebuilt automatically when the PathFinder's map
+ *       version changes. Queries on one instance are not thread safe, but
+ *       queryBatch() parallelizes internally.
+ */
+class MovementRange
+{
+private:
+    const PathFinder &pathfinder; ///< Engine providing the map
+    uint64_t planeVersion;        ///< Map version the bitboard was built from
+    bool planeBuilt;              ///< true once the bitboard exists
+    int width;                    ///< Map width of the bitboard
+    int height;                   ///< Map height of the bitboard
+    int wordsPerRow;              ///< 64-bit words per bitboard row
+    std::vector<uint64_t> plane;  ///< Reachable bit per tile, one padded row of words per map row
+
+    /**
+     * @brief Rebuild the bitboard if the map changed
+     * @return false if no map is loaded
+     */
+    bool refreshPlane();
+
+    /**
+     * @brief Flood fill one range on the current bitboard
+     * @param origin Tile to start from
+     * @param radius Maximum number of moves
+     * @param range Receives the result
+     * @return false if the origin is not a reachable tile
+     *
+     * Only reads the bitboard, so several threads may call it at once.
+     */
+    bool compute(const Position &origin, int radius, RangeMask &range) const;
+
+public:
+    static const int MAX_RADIUS = 0xFFFE; ///< Largest radius the 16-bit distance plane can hold
+
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit MovementRange(const PathFinder &engine);
+
+    /**
+     * @brief Find the tiles reachable within a number of moves
+     * @param origin Tile to start from
+     * @param radius Maximum number of moves (clamped to [0, MAX_RADIUS])
+     * @param range Receives the mask and distance plane
+     * @return false if no map is loaded or the origin is not reachable; range is then empty
+     */
+    bool query(const Position &origin, int radius, RangeMask &range);
+
+    /**
+     * @brief Compute the ranges of many units
+     * @param origins Tiles to start from
+     * @param radius Maximum number of moves for every unit
+     * @param threads Threads to use: 1 = the calling thread, otherwise up to this many shared TaskPool workers
+     * @return One range per origin, in order (empty where the origin is not reachable)
+     */
+    std::vector<RangeMask> queryBatch(const std::vector<Position> &origins, int radius, int threads = 1);
+};
+
+#endif // MOVEMENTRANGE_H
@@ -0,0 +1,227 @@
+/**
+ * @file MovingTargetSearch.cpp
+ * @brief Generalized Adaptive A* for pursuing moving targets - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the MovingTargetSearch: lazy
+ * heuristic initialization, the correction for a moved target, A* over
+ * stamped flat arrays and the reuse of the previous path.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "MovingTargetSearch.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    const int UNREACHED = 0x3fffffff;
+
+    // Search ids before the learned data is rebuilt (bounds pathCost/heuristicShift)
+    const uint32_t MAX_SEARCH_ID = 1u << 16;
+}
+
+MovingTargetSearch::MovingTargetSearch(const PathFinder &engine)
+    : pathfinder(engine), mapVersion(engine.getMapVersion()), counter(0)
+{
+}
+
+void MovingTargetSearch::reset()
+{
+    heuristic.clear();
+    gCost.clear();
+    parent.clear();
+    searchOf.clear();
+    closed.clear();
+    pathCost.clear();
+    heuristicShift.clear();
+    pathOffset.clear();
+    lastPath.clear();
+    counter = 0;
+    stats.resets++;
+}
+
+int MovingTargetSearch::manhattanToGoal(int index) const
+{
+    int width = pathfinder.getBattleMap().width;
+    return std::abs(index % width - goal.x) + std::abs(index / width - goal.y);
+}
+
+void MovingTargetSearch::initializeTile(int index)
+{
+    uint32_t previous = searchOf[index];
+    if (previous == counter)
+        return;
+
+    if (previous != 0)
+    {
+        // Adaptive A* update from the search that last saw this tile...
+        if (gCost[index] < UNREACHED && gCost[index] + heuristic[index] < pathCost[previous])
+            heuristic[index] = pathCost[previous] - gCost[index];
+        // ...then the corrections for every target move since
+        heuristic[index] -= heuristicShift[counter] - heuristicShift[previous];
+        heuristic[index] = std::max(heuristic[index], manhattanToGoal(index));
+    }
+    else
+    {
+        heuristic[index] = manhattanToGoal(index);
+    }
+
+    gCost[index] = UNREACHED;
+    closed[index] = 0;
+    searchOf[index] = counter;
+}
+
+void MovingTargetSearch::rememberPath(const std::vector<Position> &path)
+{
+    int width = pathfinder.getBattleMap().width;
+    for (const Position &tile : lastPath)
+    {
+        pathOffset[tile.y * width + tile.x] = -1;
+    }
+    lastPath = path;
+    for (size_t i = 0; i < lastPath.size(); ++i)
+    {
+        pathOffset[lastPath[i].y * width + lastPath[i].x] = static_cast<int>(i);
+    }
+}
+
+std::vector<Position> MovingTargetSearch::findPath(const Position &start, const Position &target)
+{
+    lastSearchStats = SearchStats();
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    int width = map.width;
+    size_t tileCount = static_cast<size_t>(width) * map.height;
+    if (mapVersion != pathfinder.getMapVersion() || searchOf.size() != tileCount || counter >= MAX_SEARCH_ID)
+    {
+        if (counter > 0)
+            reset();
+        mapVersion = pathfinder.getMapVersion();
+    }
+    if (searchOf.size() != tileCount)
+    {
+        heuristic.assign(tileCount, 0);
+        gCost.assign(tileCount, UNREACHED);
+        parent.assign(tileCount, -1);
+        searchOf.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        pathOffset.assign(tileCount, -1);
+    }
+
+    int startIndex = start.y * width + start.x;
+    int targetIndex = target.y * width + target.x;
+
+    // Both ends still on the last path, in order: its segment is a shortest path
+    int from = pathOffset[startIndex];
+    int to = pathOffset[targetIndex];
+    if (from >= 0 && to >= from)
+    {
+        stats.segmentReuses++;
+        lastSearchStats.pathCost = to - from;
+        return std::vector<Position>(lastPath.begin() + from, lastPath.begin() + to + 1);
+    }
+
+    if (counter == 0)
+    {
+        counter = 1;
+        pathCost.assign(2, 0);
+        heuristicShift.assign(2, 0);
+        goal = target;
+    }
+    else
+    {
+        int shift = 0;
+        if (!(target == goal))
+        {
+            // h(new goal) w.r.t. the old goal bounds how much any value may drop
+            initializeTile(targetIndex);
+            if (gCost[targetIndex] < UNREACHED && gCost[targetIndex] + heuristic[targetIndex] < pathCost[counter])
+                heuristic[targetIndex] = pathCost[counter] - gCost[targetIndex];
+            shift = heuristic[targetIndex];
+            goal = target;
+            stats.targetShifts++;
+        }
+        heuristicShift.push_back(heuristicShift[counter] + shift);
+        pathCost.push_back(0);
+        counter++;
+    }
+
+    stats.searches++;
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+
+    initializeTile(startIndex);
+    initializeTile(targetIndex);
+    gCost[startIndex] = 0;
+    parent[startIndex] = -1;
+    open.clear();
+    OpenEntry first = {heuristic[startIndex], 0, startIndex};
+    open.push_back(first);
+    lastSearchStats.nodesGenerated = 1;
+
+    bool found = false;
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.index;
+        if (closed[current] || entry.g != gCost[current])
+            continue;
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        if (current == targetIndex)
+        {
+            found = true;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int nextCost = gCost[current] + 1;
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            initializeTile(neighbor);
+            if (closed[neighbor] || gCost[neighbor] <= nextCost)
+                continue;
+
+            gCost[neighbor] = nextCost;
+            parent[neighbor] = current;
+            OpenEntry next = {nextCost + heuristic[neighbor], nextCost, neighbor};
+            open.push_back(next);
+            std::push_heap(open.begin(), open.end());
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (!found)
+    {
+        // Learned values toward an unreachable goal cannot be corrected later
+        reset();
+        return {};
+    }
+
+    pathCost[counter] = gCost[targetIndex];
+    lastSearchStats.pathCost = gCost[targetIndex];
+
+    std::vector<Position> path;
+    for (int index = targetIndex; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    std::reverse(path.begin(), path.end());
+    rememberPath(path);
+    return path;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file MovingTargetSearch.h
+ * @brief Generalized Adaptive A* for pursuing moving targets - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the MovingTargetSearch engine used by pursuit orders.
+ * It keeps its search state between calls while both the pursuer and the
+ * pursued unit move, so each replanning step only corrects the heuristic
+ * for the target's displacement instead of starting from scratch.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef MOVINGTARGETSEARCH_H
+#define MOVINGTARGETSEARCH_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Counters describing a pursuit so far
+ */
+struct PursuitStats
+{
+    size_t searches;      ///< A* searches run
+    size_t segmentReuses; ///< Calls answered from the previous path without searching
+    size_t targetShifts;  ///< Heuristic corrections for a moved target
+    size_t resets;        ///< Times all learned data was dropped
+
+    /**
+     * @brief Default constructor initializing all counters to zero
+     */
+    PursuitStats() : searches(0), segmentReuses(0), targetShifts(0), resets(0) {}
+};
+
+/**
+ * @brief Moving-target A* search (Generalized Adaptive A*, Sun, Koenig and Yeoh 2008)
+ *
+ * After each search, expanded tiles learn h(s) = g(goal) - g(s), as in
+ * Adaptive A*. When the target moves from the old goal to a new tile, every
+ * learned value is shifted down by h(new goal); because the learned values
+ * are consistent, the shifted values are still admissible for the new goal.
+ * Both corrections are applied lazily, the first time a later search touches
+ * a tile, so a target move costs O(1) and nothing is cleared between calls.
+ * Returned paths are always shortest paths.
+ *
+ * When the pursuer and the target both still lie on the last returned path,
+ * in that order, the segment between them is returned without searching
+ * (a segment of a shortest path is a shortest path).
+ *
+ * @par Usage Example:
+ * @code
+ * MovingTargetSearch pursuit(pathfinder);
+ * while (chasing)
+ * {
+ *     std::vector<Position> path = pursuit.findPath(hunter.pos, prey.pos);
+ *     hunter.moveTo(path[1]);
+ *     prey.update();
+ * }
+ * @endcode
+ *
+ * @note Learned data is dropped automatically when the engine's map version
+ *       changes (PathFinder::setTile() or a reload). Use one instance per
+ *       pursuing unit.
+ */
+class MovingTargetSearch
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int g;     ///< Cost from the start, higher wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing map and move order
+    uint64_t mapVersion;          ///< Map version the learned data belongs to
+
+    std::vector<int> heuristic;      ///< Heuristic per tile, relative to the goal of searchOf
+    std::vector<int> gCost;          ///< Cost per tile from the search in searchOf
+    std::vector<int> parent;         ///< Predecessor tile index per tile
+    std::vector<uint32_t> searchOf;  ///< Search that last initialized each tile (0 = never)
+    std::vector<uint8_t> closed;     ///< Expanded flag, valid where searchOf is the current search
+    std::vector<int> pathCost;       ///< Goal cost of each search id
+    std::vector<int> heuristicShift; ///< Total target displacement correction up to each search id
+    std::vector<OpenEntry> open;     ///< Binary heap of open entries
+    uint32_t counter;                ///< Current search id (0 = no search yet)
+    Position goal;                   ///< Goal of the current search id
+
+    std::vector<Position> lastPath; ///< Last path returned
+    std::vector<int> pathOffset;    ///< Index in lastPath per tile (-1 = not on it)
+
+    PursuitStats stats;          ///< Pursuit counters
+    SearchStats lastSearchStats; ///< Effort of the last findPath() call
+
+    /**
+     * @brief Bring a tile's g and heuristic up to date for the current search
+     * @param index Tile index
+     */
+    void initializeTile(int index);
+
+    /**
+     * @brief Manhattan distance from a tile to the current goal
+     */
+    int manhattanToGoal(int index) const;
+
+    /**
+     * @brief Replace the remembered path
+     * @param path New path (may be empty)
+     */
+    void rememberPath(const std::vector<Position> &path);
+
+public:
+    /**
+     * @brief Create a pursuit engine over a loaded PathFinder
+     * @param engine Engine providing the map and move order (must outlive this object)
+     */
+    explicit MovingTargetSearch(const PathFinder &engine);
+
+    /**
+     * @brief Find a shortest path from the pursuer to the target's current position
+     * @param start Current position of the pursuer
+     * @param target Current position of the target
+     * @return Path from start to target, empty if none exists
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target);
+
+    /**
+     * @brief Drop all learned data (needed after terrain edits that bypass PathFinder::setTile())
+     */
+    void reset();
+
+    /**
+     * @brief Get search effort of the last findPath() call
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+
+    /**
+     * @brief Get pursuit counters
+     */
+    const PursuitStats &getStats() const { return stats; }
+};
+
+#endif // MOVINGTARGETSEARCH_H
@@ -14,17 +14,29 @@
  */
 
 #include "MultiUnitPathFinder.h"
+#include "../TaskPool/TaskPool.h"
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
 #include <cstdlib>
 
-MultiUnitPathFinder::MultiUnitPathFinder() : PathFinder()
+MultiUnitPathFinder::MultiUnitPathFinder()
+    : PathFinder(), verbose(true), congestionWeight(0.0), congestionWindow(1), laneMode(LaneMode::OFF),
+      lanePenalty(2.0)
 {
     strategy = ConflictResolutionStrategy::SEQUENTIAL;
 }
 
-MultiUnitPathFinder::MultiUnitPathFinder(const std::string &moveOrder) : PathFinder(moveOrder)
+MultiUnitPathFinder::MultiUnitPathFinder(const std::string &moveOrder)
+    : PathFinder(moveOrder), verbose(true), congestionWeight(0.0), congestionWindow(1), laneMode(LaneMode::OFF),
+      lanePenalty(2.0)
+{
+    strategy = ConflictResolutionStrategy::SEQUENTIAL;
+}
+
+MultiUnitPathFinder::MultiUnitPathFinder(const PathFinder &engine)
+    : PathFinder(engine), verbose(true), congestionWeight(0.0), congestionWindow(1), laneMode(LaneMode::OFF),
+      lanePenalty(2.0)
 {
     strategy = ConflictResolutionStrategy::SEQUENTIAL;
 }
@@ -91,6 +103,154 @@ ConflictResolutionStrategy MultiUnitPathFinder::getConflictResolutionStrategy()
     return strategy;
 }
 
+void MultiUnitPathFinder::setCongestionAvoidance(double weight, int window)
+{
+    congestionWeight = std::max(0.0, weight);
+    congestionWindow = std::max(1, window);
+    congestionByWindow.clear(); // Densities are bucketed by window, so rebuild them with the next paths
+}
+
+bool MultiUnitPathFinder::setLanes(const std::vector<int> &directions)
+{
+    if (!isMapLoaded() || directions.size() != static_cast<size_t>(battleMap.width) * battleMap.height)
+    {
+        std::cerr << "Error: Lane data does not match the map size" << std::endl;
+        return false;
+    }
+    for (int direction : directions)
+    {
+        if (direction < static_cast<int>(LaneDirection::NONE) || direction > static_cast<int>(LaneDirection::UP))
+        {
+            std::cerr << "Error: Invalid lane direction " << direction << std::endl;
+            return false;
+        }
+    }
+    lanes.assign(directions.begin(), directions.end());
+    return true;
+}
+
+int MultiUnitPathFinder::generateLanes()
+{
+    lanes.clear();
+    if (!isMapLoaded())
+        return 0;
+
+    const int width = battleMap.width;
+    const int height = battleMap.height;
+    lanes.assign(static_cast<size_t>(width) * height, static_cast<uint8_t>(LaneDirection::NONE));
+
+    // Outside the map counts as a wall
+    auto open = [&](int x, int y)
+    { return battleMap.isReachable(x, y); };
+    // (x,y) and (x,y+1) form a cross-section of a horizontal corridor
+    auto horizontalPair = [&](int x, int y)
+    { return open(x, y) && open(x, y + 1) && !open(x, y - 1) && !open(x, y + 2); };
+    // (x,y) and (x+1,y) form a cross-section of a vertical corridor
+    auto verticalPair = [&](int x, int y)
+    { return open(x, y) && open(x + 1, y) && !open(x - 1, y) && !open(x + 2, y); };
+
+    // Only the interior of a run of cross-sections gets lanes; its first and last pair stay free
+    // so units can enter, leave and switch rows at the mouths, and no tile is cut off
+    int annotated = 0;
+    auto mark = [&](int x, int y, LaneDirection lane)
+    {
+        lanes[static_cast<size_t>(y) * width + x] = static_cast<uint8_t>(lane);
+        annotated++;
+    };
+
+    for (int y = 0; y + 1 < height; ++y)
+    {
+        for (int x = 0; x < width;)
+        {
+            int end = x;
+            while (end < width && horizontalPair(end, y))
+                end++;
+            for (int inner = x + 1; inner + 1 < end; ++inner)
+            {
+                mark(inner, y, LaneDirection::LEFT);
+                mark(inner, y + 1, LaneDirection::RIGHT);
+            }
+            x = std::max(end, x + 1);
+        }
+    }
+
+    for (int x = 0; x + 1 < width; ++x)
+    {
+        for (int y = 0; y < height;)
+        {
+            int end = y;
+            while (end < height && verticalPair(x, end))
+                end++;
+            for (int inner = y + 1; inner + 1 < end; ++inner)
+            {
+                mark(x, inner, LaneDirection::DOWN);
+                mark(x + 1, inner, LaneDirection::UP);
+            }
+            y = std::max(end, y + 1);
+        }
+    }
+    return annotated;
+}
+
+void MultiUnitPathFinder::clearLanes()
+{
+    lanes.clear();
+}
+
+LaneDirection MultiUnitPathFinder::getLane(int x, int y) const
+{
+    if (!battleMap.isValidPosition(x, y) || lanes.size() != static_cast<size_t>(battleMap.width) * battleMap.height)
+        return LaneDirection::NONE;
+    return static_cast<LaneDirection>(lanes[static_cast<size_t>(y) * battleMap.width + x]);
+}
+
+void MultiUnitPathFinder::setLaneMode(LaneMode mode, double penalty)
+{
+    laneMode = mode;
+    lanePenalty = std::max(0.0, penalty);
+}
+
+bool MultiUnitPathFinder::isReachableAlongLanes(const Position &start, const Position &target) const
+{
+    if (!battleMap.isReachable(start.x, start.y) || !battleMap.isReachable(target.x, target.y))
+        return false;
+
+    // Breadth-first search over tiles with the FORBID rule and no other units
+    std::vector<uint8_t> seen(static_cast<size_t>(battleMap.width) * battleMap.height, 0);
+    std::vector<Position> queue(1, start);
+    seen[static_cast<size_t>(start.y) * battleMap.width + start.x] = 1;
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        Position current = queue[head];
+        if (current == target)
+            return true;
+        for (const auto &dir : moveDirections)
+        {
+            Position next(current.x + dir.first, current.y + dir.second);
+            if (!battleMap.isReachable(next.x, next.y) || isAgainstLane(current, next))
+                continue;
+            uint8_t &visited = seen[static_cast<size_t>(next.y) * battleMap.width + next.x];
+            if (visited)
+                continue;
+            visited = 1;
+            queue.push_back(next);
+        }
+    }
+    return false;
+}
+
+void MultiUnitPathFinder::setVerbose(bool enabled)
+{
+    verbose = enabled;
+}
+
+std::ostream &MultiUnitPathFinder::trace() const
+{
+    // A stream without a buffer discards everything written to it
+    static thread_local std::ostream discard(nullptr);
+    return verbose ? std::cout : discard;
+}
+
 PathfindingResult MultiUnitPathFinder::findPathsForAllUnits()
 {
     if (units.empty())
@@ -105,28 +265,28 @@ PathfindingResult MultiUnitPathFinder::findPathsForAllUnits()
         return PathfindingResult();
     }
 
-    std::cout << "\n=== Multi-Unit Pathfinding ===\n";
-    std::cout << "Number of units: " << units.size() << std::endl;
-    std::cout << "Strategy: ";
+    trace() << "\n=== Multi-Unit Pathfinding ===\n";
+    trace() << "Number of units: " << units.size() << std::endl;
+    trace() << "Strategy: ";
 
     PathfindingResult result;
 
     switch (strategy)
     {
     case ConflictResolutionStrategy::SEQUENTIAL:
-        std::cout << "Sequential" << std::endl;
+        trace() << "Sequential" << std::endl;
         result = findPathsSequential();
         break;
     case ConflictResolutionStrategy::PRIORITY_BASED:
-        std::cout << "Priority-based" << std::endl;
+        trace() << "Priority-based" << std::endl;
         result = findPathsPriorityBased();
         break;
     case ConflictResolutionStrategy::COOPERATIVE:
-        std::cout << "Cooperative" << std::endl;
+        trace() << "Cooperative" << std::endl;
         result = findPathsCooperative();
         break;
     case ConflictResolutionStrategy::WAIT_AND_RETRY:
-        std::cout << "Wait-and-retry" << std::endl;
+        trace() << "Wait-and-retry" << std::endl;
         result = findPathsWithWaiting();
         break;
     }
@@ -193,7 +353,7 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
 
     std::priority_queue<std::shared_ptr<PathNode>, std::vector<std::shared_ptr<PathNode>>, PathNodeComparator> openSet;
     std::unordered_set<std::string> closedSet;                               // Use string key for position+time
-    std::unordered_map<std::string, std::shared_ptr<PathNode>> openSetNodes; // Track nodes in open set
+    std::unordered_map<std::string, std::shared_ptr<PathNode>> openSetNodes; // Best open node per position+time
 
     // Start node
     auto startNode = std::make_shared<PathNode>(start, 0, 0.0, calculateHeuristic(start, target));
@@ -207,17 +367,21 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
 
     while (!openSet.empty() && iterations < maxIterations)
     {
-        iterations++;
         auto current = openSet.top();
         openSet.pop();
 
+        // Improved costs push a new node instead of editing one inside the heap, so skip superseded ones
         std::string currentKey = positionTimeKey(current->pos, current->time);
-        openSetNodes.erase(currentKey);
+        auto best = openSetNodes.find(currentKey);
+        if (best == openSetNodes.end() || best->second != current)
+            continue;
+        openSetNodes.erase(best);
+        iterations++;
 
         // Check if we reached the target
         if (current->pos == target)
         {
-            std::cout << "Path found after " << iterations << " iterations, "
+            trace() << "Path found after " << iterations << " iterations, "
                       << "final time: " << current->time << std::endl;
             return reconstructPathFromNode(current);
         }
@@ -237,7 +401,13 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
                 continue; // Skip if already evaluated
             }
 
-            double tentativeGCost = current->gCost + 1.0; // Movement cost is 1
+            double tentativeGCost = current->gCost + 1.0 + congestionCost(neighbor, nextTime); // Movement cost is 1
+            if (isAgainstLane(current->pos, neighbor))
+            {
+                if (laneMode == LaneMode::FORBID)
+                    continue;
+                tentativeGCost += lanePenalty;
+            }
 
             // Check if this path to neighbor is better
             auto existingNode = openSetNodes.find(neighborKey);
@@ -255,10 +425,15 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
             }
             else if (tentativeGCost < existingNode->second->gCost)
             {
-                // Better path found
-                existingNode->second->gCost = tentativeGCost;
-                existingNode->second->fCost = tentativeGCost + existingNode->second->hCost;
-                existingNode->second->parent = current;
+                // Better path found; the old node stays in the heap and is skipped when popped
+                auto betterNode = std::make_shared<PathNode>(
+                    neighbor,
+                    nextTime,
+                    tentativeGCost,
+                    existingNode->second->hCost,
+                    current);
+                openSet.push(betterNode);
+                existingNode->second = betterNode;
             }
         }
 
@@ -270,7 +445,7 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
 
             if (closedSet.find(waitKey) == closedSet.end())
             {
-                double waitGCost = current->gCost + 1.0; // Waiting also costs 1 time unit
+                double waitGCost = current->gCost + 1.0 + congestionCost(current->pos, nextTime); // Waiting also costs 1 time unit
 
                 auto existingWaitNode = openSetNodes.find(waitKey);
                 if (existingWaitNode == openSetNodes.end())
@@ -286,15 +461,20 @@ std::vector<Position> MultiUnitPathFinder::findPathAStarWithOccupiedCheck(const
                 }
                 else if (waitGCost < existingWaitNode->second->gCost)
                 {
-                    existingWaitNode->second->gCost = waitGCost;
-                    existingWaitNode->second->fCost = waitGCost + existingWaitNode->second->hCost;
-                    existingWaitNode->second->parent = current;
+                    auto betterWaitNode = std::make_shared<PathNode>(
+                        current->pos,
+                        nextTime,
+                        waitGCost,
+                        existingWaitNode->second->hCost,
+                        current);
+                    openSet.push(betterWaitNode);
+                    existingWaitNode->second = betterWaitNode;
                 }
             }
         }
     }
 
-    std::cout << "No path found after " << iterations << " iterations" << std::endl;
+    trace() << "No path found after " << iterations << " iterations" << std::endl;
     return {}; // No path found
 }
 
@@ -304,20 +484,20 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
     result.units = units; // Copy units
     clearOccupiedPositions();
 
-    std::cout << "Starting sequential pathfinding for " << result.units.size() << " units" << std::endl;
+    trace() << "Starting sequential pathfinding for " << result.units.size() << " units" << std::endl;
 
     for (size_t unitIndex = 0; unitIndex < result.units.size(); ++unitIndex)
     {
         auto &unit = result.units[unitIndex];
-        std::cout << "\n=== Processing Unit " << unit.id << " (index " << unitIndex << ") ===" << std::endl;
-        std::cout << "Start: (" << unit.startPos.x << "," << unit.startPos.y << ")" << std::endl;
-        std::cout << "Target: (" << unit.targetPos.x << "," << unit.targetPos.y << ")" << std::endl;
+        trace() << "\n=== Processing Unit " << unit.id << " (index " << unitIndex << ") ===" << std::endl;
+        trace() << "Start: (" << unit.startPos.x << "," << unit.startPos.y << ")" << std::endl;
+        trace() << "Target: (" << unit.targetPos.x << "," << unit.targetPos.y << ")" << std::endl;
 
         // Validate unit positions
         if (!battleMap.isValidPosition(unit.startPos.x, unit.startPos.y) ||
             !battleMap.isValidPosition(unit.targetPos.x, unit.targetPos.y))
         {
-            std::cout << "ERROR: Invalid start or target position for Unit " << unit.id << std::endl;
+            trace() << "ERROR: Invalid start or target position for Unit " << unit.id << std::endl;
             unit.pathFound = false;
             continue;
         }
@@ -325,7 +505,7 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
         // Check if start position is reachable
         if (!battleMap.isReachable(unit.startPos.x, unit.startPos.y))
         {
-            std::cout << "ERROR: Start position is not reachable for Unit " << unit.id << std::endl;
+            trace() << "ERROR: Start position is not reachable for Unit " << unit.id << std::endl;
             unit.pathFound = false;
             continue;
         }
@@ -333,7 +513,7 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
         // Check if target position is reachable
         if (!battleMap.isReachable(unit.targetPos.x, unit.targetPos.y))
         {
-            std::cout << "ERROR: Target position is not reachable for Unit " << unit.id << std::endl;
+            trace() << "ERROR: Target position is not reachable for Unit " << unit.id << std::endl;
             unit.pathFound = false;
             continue;
         }
@@ -341,7 +521,7 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
         // Check if start and target are the same
         if (unit.startPos == unit.targetPos)
         {
-            std::cout << "Unit " << unit.id << " is already at target position" << std::endl;
+            trace() << "Unit " << unit.id << " is already at target position" << std::endl;
             unit.path = {unit.startPos}; // Path with just the start position
             unit.pathFound = true;
             updateOccupiedPositions(unit.path, 0);
@@ -356,36 +536,42 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
             unit.path = path;
             unit.pathFound = true;
             updateOccupiedPositions(path, 0);
-            std::cout << "SUCCESS: Path found for Unit " << unit.id << " (" << path.size() << " steps)" << std::endl;
+            trace() << "SUCCESS: Path found for Unit " << unit.id << " (" << path.size() << " steps)" << std::endl;
 
             // Print first few steps of the path
-            std::cout << "Path preview: ";
+            trace() << "Path preview: ";
             for (size_t i = 0; i < std::min(path.size(), size_t(5)); ++i)
             {
-                std::cout << "(" << path[i].x << "," << path[i].y << ")";
+                trace() << "(" << path[i].x << "," << path[i].y << ")";
                 if (i < path.size() - 1)
-                    std::cout << " -> ";
+                    trace() << " -> ";
             }
             if (path.size() > 5)
-                std::cout << " ... ";
-            std::cout << std::endl;
+                trace() << " ... ";
+            trace() << std::endl;
         }
         else
         {
             unit.pathFound = false;
-            std::cout << "FAILURE: No path found for Unit " << unit.id << std::endl;
+            trace() << "FAILURE: No path found for Unit " << unit.id << std::endl;
 
             // Try fallback: regular A* without occupied position checking
-            std::cout << "Trying fallback pathfinding without occupied position constraints..." << std::endl;
+            trace() << "Trying fallback pathfinding without occupied position constraints..." << std::endl;
             std::vector<Position> fallbackPath = findPathAStar(unit.startPos, unit.targetPos);
-            if (!fallbackPath.empty())
+            if (!fallbackPath.empty() && laneMode == LaneMode::FORBID &&
+                !isReachableAlongLanes(unit.startPos, unit.targetPos))
+            {
+                trace() << "Fallback path exists (" << fallbackPath.size() << " steps), "
+                          << "but every route moves against a lane (lane mode FORBID)" << std::endl;
+            }
+            else if (!fallbackPath.empty())
             {
-                std::cout << "Fallback path exists (" << fallbackPath.size() << " steps), "
+                trace() << "Fallback path exists (" << fallbackPath.size() << " steps), "
                           << "but blocked by other units" << std::endl;
             }
             else
             {
-                std::cout << "No path exists between start and target positions" << std::endl;
+                trace() << "No path exists between start and target positions" << std::endl;
             }
         }
     }
@@ -405,11 +591,11 @@ PathfindingResult MultiUnitPathFinder::findPathsSequential()
         }
     }
 
-    std::cout << "\n=== Sequential Pathfinding Summary ===" << std::endl;
-    std::cout << "Units processed: " << result.units.size() << std::endl;
-    std::cout << "Successful paths: " << successCount << std::endl;
-    std::cout << "Failed paths: " << (result.units.size() - successCount) << std::endl;
-    std::cout << "All paths found: " << (result.allPathsFound ? "YES" : "NO") << std::endl;
+    trace() << "\n=== Sequential Pathfinding Summary ===" << std::endl;
+    trace() << "Units processed: " << result.units.size() << std::endl;
+    trace() << "Successful paths: " << successCount << std::endl;
+    trace() << "Failed paths: " << (result.units.size() - successCount) << std::endl;
+    trace() << "All paths found: " << (result.allPathsFound ? "YES" : "NO") << std::endl;
 
     return result;
 }
@@ -427,10 +613,10 @@ PathfindingResult MultiUnitPathFinder::findPathsPriorityBased()
                   return getUnitPriority(a.id) > getUnitPriority(b.id);
               });
 
-    std::cout << "Unit processing order by priority:" << std::endl;
+    trace() << "Unit processing order by priority:" << std::endl;
     for (const auto &unit : result.units)
     {
-        std::cout << "  Unit " << unit.id << " (priority: " << getUnitPriority(unit.id) << ")" << std::endl;
+        trace() << "  Unit " << unit.id << " (priority: " << getUnitPriority(unit.id) << ")" << std::endl;
     }
 
     // Use sequential pathfinding on the prioritized list
@@ -447,7 +633,7 @@ PathfindingResult MultiUnitPathFinder::findPathsCooperative()
 {
     // Implemented as sequential with multiple attempts
     // @todo: Potential future improvement: could use algorithms like CBS (Conflict-Based Search)
-    std::cout << "Note: Cooperative strategy currently implemented as enhanced version of sequential" << std::endl;
+    trace() << "Note: Cooperative strategy currently implemented as enhanced version of sequential" << std::endl;
 
     PathfindingResult result;
     result.units = units;
@@ -455,9 +641,14 @@ PathfindingResult MultiUnitPathFinder::findPathsCooperative()
 
     int maxAttempts = 3;
 
+    // Units are searched independently, so each attempt runs them in parallel
+    TaskPool &pool = TaskPool::shared();
+    std::vector<PathFinder> engines(pool.size(), static_cast<const PathFinder &>(*this));
+    std::vector<std::vector<Position>> paths;
+
     for (int attempt = 0; attempt < maxAttempts; ++attempt)
     {
-        std::cout << "\nAttempt " << (attempt + 1) << "/" << maxAttempts << std::endl;
+        trace() << "\nAttempt " << (attempt + 1) << "/" << maxAttempts << std::endl;
 
         // Try different unit ordering for each attempt
         if (attempt > 0)
@@ -468,34 +659,20 @@ PathfindingResult MultiUnitPathFinder::findPathsCooperative()
             clearOccupiedPositions();
         }
 
-        bool allFound = true;
-        for (auto &unit : result.units)
-        {
-            // Find path similar to sequential method
-            BattleMap tempMap = battleMap;
-            tempMap.startPos = unit.startPos;
-            tempMap.targetPos = unit.targetPos;
-
-            // Clear previous start/target markers
-            for (int y = 0; y < tempMap.height; ++y)
-            {
-                for (int x = 0; x < tempMap.width; ++x)
-                {
-                    if (tempMap.grid[y][x] == 0 || tempMap.grid[y][x] == 8)
+        paths.assign(result.units.size(), std::vector<Position>());
+        parallelFor(pool, 0, result.units.size(), 1, [&](size_t begin, size_t end)
                     {
-                        tempMap.grid[y][x] = -1;
-                    }
-                }
-            }
-
-            tempMap.grid[unit.startPos.y][unit.startPos.x] = 0;
-            tempMap.grid[unit.targetPos.y][unit.targetPos.x] = 8;
+                        PathFinder &engine = engines[TaskPool::workerIndex()];
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            paths[i] = engine.findPathAStar(result.units[i].startPos, result.units[i].targetPos);
+                        } });
 
-            BattleMap originalMap = battleMap;
-            battleMap = tempMap;
-
-            std::vector<Position> path = findPathAStar();
-            battleMap = originalMap;
+        bool allFound = true;
+        for (size_t i = 0; i < result.units.size(); ++i)
+        {
+            Unit &unit = result.units[i];
+            const std::vector<Position> &path = paths[i];
 
             if (!path.empty())
             {
@@ -522,7 +699,7 @@ PathfindingResult MultiUnitPathFinder::findPathsCooperative()
 
 PathfindingResult MultiUnitPathFinder::findPathsWithWaiting()
 {
-    std::cout << "Note: Wait-and-retry strategy allows units to wait in place when blocked" << std::endl;
+    trace() << "Note: Wait-and-retry strategy allows units to wait in place when blocked" << std::endl;
 
     // Start with sequential pathfinding
     PathfindingResult result = findPathsSequential();
@@ -534,7 +711,7 @@ PathfindingResult MultiUnitPathFinder::findPathsWithWaiting()
 
         if (!conflicts.empty())
         {
-            std::cout << "Detected conflicts, attempting to resolve with wait steps..." << std::endl;
+            trace() << "Detected conflicts, attempting to resolve with wait steps..." << std::endl;
 
             // For each conflict, try to add wait steps to one of the conflicting units
             for (const auto &conflict : conflicts)
@@ -606,6 +783,19 @@ void MultiUnitPathFinder::updateOccupiedPositions(const std::vector<Position> &p
         if (battleMap.isValidPosition(pos.x, pos.y))
         {
             occupiedPositionsAtTime[timeStep].insert(pos);
+
+            if (congestionWeight > 0.0)
+            {
+                size_t window = static_cast<size_t>(timeStep / congestionWindow);
+                if (window >= congestionByWindow.size())
+                    congestionByWindow.resize(window + 1);
+                std::vector<uint16_t> &density = congestionByWindow[window];
+                if (density.empty())
+                    density.assign(static_cast<size_t>(battleMap.width) * battleMap.height, 0);
+                uint16_t &count = density[static_cast<size_t>(pos.y) * battleMap.width + pos.x];
+                if (count < 0xFFFF)
+                    count++;
+            }
         }
         else
         {
@@ -618,6 +808,7 @@ void MultiUnitPathFinder::updateOccupiedPositions(const std::vector<Position> &p
 void MultiUnitPathFinder::clearOccupiedPositions()
 {
     occupiedPositionsAtTime.clear();
+    congestionByWindow.clear();
 }
 
 std::vector<Position> MultiUnitPathFinder::addWaitSteps(const std::vector<Position> &originalPath, const std::set<int> &waitAtSteps) const
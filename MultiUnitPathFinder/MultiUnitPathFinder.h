@@ -25,6 +25,7 @@
 #include <memory>
 #include <unordered_map>
 #include <random>
+#include <cstdint>
 
 //==============================================================================
 // FORWARD DECLARATIONS AND ENUMERATIONS
@@ -45,6 +46,32 @@ enum class ConflictResolutionStrategy
     WAIT_AND_RETRY  ///< Units can wait in place when blocked by other units
 };
 
+/**
+ * @enum LaneDirection
+ * @brief Preferred direction of travel through a tile
+ *
+ * Values match the codes of a "lanes" map layer (0 = no lane).
+ */
+enum class LaneDirection : uint8_t
+{
+    NONE = 0,  ///< No preferred direction
+    RIGHT = 1, ///< Traffic flows toward +x
+    DOWN = 2,  ///< Traffic flows toward +y
+    LEFT = 3,  ///< Traffic flows toward -x
+    UP = 4     ///< Traffic flows toward -y
+};
+
+/**
+ * @enum LaneMode
+ * @brief How the temporal A* treats moves against a tile's lane direction
+ */
+enum class LaneMode
+{
+    OFF,      ///< Lanes are ignored
+    PENALIZE, ///< Moves against a lane cost extra
+    FORBID    ///< Moves against a lane are not allowed
+};
+
 //==============================================================================
 // DATA STRUCTURES
 //==============================================================================
@@ -195,14 +222,31 @@ private:
     std::vector<Unit> units;             ///< Collection of all units to pathfind
     ConflictResolutionStrategy strategy; ///< Current conflict resolution strategy
     std::map<int, int> unitPriorities;   ///< Unit ID to priority mapping
+    bool verbose;                        ///< Print the search trace to stdout
 
     /// Temporal conflict tracking: time_step -> set of occupied positions
     std::map<int, std::set<Position, PositionComparator>> occupiedPositionsAtTime;
 
+    double congestionWeight; ///< Extra cost per planned unit in a tile's time window (0 = off)
+    int congestionWindow;    ///< Time steps per congestion window
+
+    /// Planned unit occupancy: time window -> unit-steps per tile (row-major, empty until used)
+    std::vector<std::vector<uint16_t>> congestionByWindow;
+
+    std::vector<uint8_t> lanes; ///< LaneDirection per tile (row-major, empty = no lanes)
+    LaneMode laneMode;          ///< How moves against a lane are treated
+    double lanePenalty;         ///< Extra move cost against a lane in PENALIZE mode
+
     //==========================================================================
     // PRIVATE HELPER METHODS
     //==========================================================================
 
+    /**
+     * @brief Stream receiving the search trace
+     * @return std::cout when verbose, otherwise a stream that discards output
+     */
+    std::ostream &trace() const;
+
     /**
      * @brief Check if two paths have any conflicts
      * @param path1 First unit's path
@@ -231,6 +275,62 @@ private:
      */
     void clearOccupiedPositions();
 
+    /**
+     * @brief Soft cost of being at a position at a time step
+     * @param pos Position to check
+     * @param time Time step to check
+     * @return congestionWeight times the unit-steps already planned on that tile in the
+     *         time step's window and the windows on either side
+     */
+    double congestionCost(const Position &pos, int time) const
+    {
+        if (congestionWeight <= 0.0)
+            return 0.0;
+        // Neighboring windows count too, so units passing just before or after are seen
+        size_t tile = static_cast<size_t>(pos.y) * battleMap.width + pos.x;
+        size_t window = static_cast<size_t>(time / congestionWindow);
+        int planned = 0;
+        for (size_t w = window > 0 ? window - 1 : 0; w <= window + 1 && w < congestionByWindow.size(); ++w)
+        {
+            if (!congestionByWindow[w].empty())
+                planned += congestionByWindow[w][tile];
+        }
+        return congestionWeight * planned;
+    }
+
+    /**
+     * @brief Check whether a move runs against the lane of its source or destination tile
+     * @param from Tile the move leaves
+     * @param to Adjacent tile the move enters
+     * @return true if either tile's lane points opposite to the move; false while lanes
+     *         are off or do not match the map size
+     */
+    bool isAgainstLane(const Position &from, const Position &to) const
+    {
+        if (laneMode == LaneMode::OFF || lanes.size() != static_cast<size_t>(battleMap.width) * battleMap.height)
+            return false;
+        // Opposite lane code of each move: right->LEFT, down->UP, left->RIGHT, up->DOWN
+        uint8_t opposite;
+        if (to.x > from.x)
+            opposite = static_cast<uint8_t>(LaneDirection::LEFT);
+        else if (to.x < from.x)
+            opposite = static_cast<uint8_t>(LaneDirection::RIGHT);
+        else if (to.y > from.y)
+            opposite = static_cast<uint8_t>(LaneDirection::UP);
+        else if (to.y < from.y)
+            opposite = static_cast<uint8_t>(LaneDirection::DOWN);
+        else
+            return false; // Waiting never runs against a lane
+        return lanes[static_cast<size_t>(from.y) * battleMap.width + from.x] == opposite ||
+               lanes[static_cast<size_t>(to.y) * battleMap.width + to.x] == opposite;
+    }
+
+    /**
+     * @brief Check whether a target can be reached without moving against a lane
+     * @return true if a route exists that FORBID allows, ignoring other units
+     */
+    bool isReachableAlongLanes(const Position &start, const Position &target) const;
+
     /**
      * @brief Sequential pathfinding strategy implementation
      * @return Pathfinding results for all units
@@ -333,6 +433,16 @@ public:
      */
     MultiUnitPathFinder(const std::string &moveOrder);
 
+    /**
+     * @brief Constructor sharing a loaded single-unit engine's map
+     * @param engine Engine whose map, move order and search settings are copied
+     *
+     * Avoids parsing the map again, e.g. when many engines serve the same
+     * map. Units, lanes and congestion state start empty, as after the
+     * default constructor.
+     */
+    explicit MultiUnitPathFinder(const PathFinder &engine);
+
     //==========================================================================
     // UNIT MANAGEMENT
     //==========================================================================
@@ -412,6 +522,90 @@ public:
      */
     ConflictResolutionStrategy getConflictResolutionStrategy() const;
 
+    /**
+     * @brief Steer units away from tiles other units are planned to use at about the same time
+     * @param weight Extra move cost per unit-step already planned on a tile in the same window (0 disables)
+     * @param window Time steps per window (at least 1)
+     *
+     * Each path recorded by the sequential strategies (sequential, priority and
+     * wait) adds one unit-step per tile and time step to a density plane per
+     * time window. The temporal A* adds weight times the density of the
+     * window and its two neighbors to every move and wait, so later units
+     * keep clear of tiles others cross at about the same time, including
+     * head-on traffic the hard collision check misses. Paths may get longer
+     * and each search expands more nodes; hard collision checks are unchanged.
+     */
+    void setCongestionAvoidance(double weight, int window = 1);
+
+    /**
+     * @brief Get the congestion weight (0 if congestion avoidance is off)
+     */
+    double getCongestionWeight() const { return congestionWeight; }
+
+    /**
+     * @brief Annotate tiles with preferred directions of travel
+     * @param directions Row-major LaneDirection codes (0-4), one per tile of the loaded map
+     * @return false (and lanes unchanged) if the size does not match the map or a code is invalid
+     *
+     * Lanes take effect once a lane mode is set with setLaneMode().
+     */
+    bool setLanes(const std::vector<int> &directions);
+
+    /**
+     * @brief Annotate two-lane corridors automatically
+     * @return Number of tiles given a lane
+     *
+     * Finds runs of at least three cross-sections that are exactly two tiles
+     * wide between walls or the map edge, and gives the two rows (or
+     * columns) opposite directions with right-hand traffic: in a horizontal
+     * corridor the upper row flows left and the lower row right; in a
+     * vertical one the left column flows down and the right column up. The
+     * first and last cross-section of each run stay free, so units can enter
+     * and switch rows at the mouths, and every tile stays reachable even
+     * with LaneMode::FORBID. One-tile corridors stay unannotated, since a
+     * one-way rule there would cut off the return trip. Replaces any
+     * previous lanes.
+     */
+    int generateLanes();
+
+    /**
+     * @brief Remove all lane annotations
+     */
+    void clearLanes();
+
+    /**
+     * @brief Get the lane direction of a tile
+     * @return LaneDirection::NONE outside the map or where no lane is set
+     */
+    LaneDirection getLane(int x, int y) const;
+
+    /**
+     * @brief Choose how the temporal A* treats moves against a lane
+     * @param mode OFF (default), PENALIZE or FORBID
+     * @param penalty Extra move cost against a lane in PENALIZE mode (at least 0)
+     *
+     * A move runs against a lane if the lane of the tile it leaves or enters
+     * points the opposite way; moves across a lane and waits are always
+     * allowed. Applies to the sequential, priority and wait strategies.
+     * FORBID can make targets unreachable that lie upstream of a one-way
+     * section; PENALIZE only steers units into the lane of their direction.
+     */
+    void setLaneMode(LaneMode mode, double penalty = 2.0);
+
+    /**
+     * @brief Get the current lane mode
+     */
+    LaneMode getLaneMode() const { return laneMode; }
+
+    /**
+     * @brief Enable or disable the search trace printed during pathfinding
+     * @param enabled true to print progress to stdout (default), false for silent operation
+     *
+     * Display methods always print; this only affects findPathsForAllUnits()
+     * and the strategies it runs. Disable it when embedding the library.
+     */
+    void setVerbose(bool enabled);
+
     //==========================================================================
     // PATHFINDING OPERATIONS
     //==========================================================================
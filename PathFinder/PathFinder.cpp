@@ -21,6 +21,14 @@
 #include <iomanip>
 #include <stack>
 #include <queue>
+#include <tuple>
+#include <cstdlib>
+
+namespace
+{
+    // Tile changes remembered for path repair; older edits force a full search
+    const size_t MAX_TILE_CHANGES = 4096;
+}
 
 // BattleMap methods
 bool BattleMap::isReachable(int x, int y) const
@@ -191,12 +199,12 @@ void BattleMap::displayMapWithPath(const std::vector<Position> &path) const
     std::cout << std::endl;
 }
 
-PathFinder::PathFinder()
+PathFinder::PathFinder() : mapVersion(0), journalStartVersion(0), pruning(nullptr), tileCosts(nullptr)
 {
     setDefaultMoveOrder();
 }
 
-PathFinder::PathFinder(const std::string &moveOrder)
+PathFinder::PathFinder(const std::string &moveOrder) : mapVersion(0), journalStartVersion(0), pruning(nullptr), tileCosts(nullptr)
 {
     if (!setMoveOrder(moveOrder))
     {
@@ -259,6 +267,11 @@ std::string PathFinder::getMoveOrder() const
     return currentMoveOrder;
 }
 
+const std::vector<std::pair<int, int>> &PathFinder::getMoveDirections() const
+{
+    return moveDirections;
+}
+
 void PathFinder::printMoveOrder() const
 {
     std::cout << "Current move order: " << currentMoveOrder << " (";
@@ -349,18 +362,21 @@ bool PathFinder::loadMapFromGrid(const std::vector<std::vector<int>> &grid)
     battleMap.grid = grid;
     battleMap.hasValidStart = false;
     battleMap.hasValidTarget = false;
+    markMapReloaded();
 
     battleMap.findAllStartAndTargetPositions();
 
     if (battleMap.allStartPositions.empty())
     {
         std::cerr << "Error: No starting positions (0) found in the map" << std::endl;
+        battleMap.grid.clear();
         return false;
     }
 
     if (battleMap.allTargetPositions.empty())
     {
         std::cerr << "Error: No target positions (8) found in the map" << std::endl;
+        battleMap.grid.clear();
         return false;
     }
 
@@ -389,6 +405,83 @@ bool PathFinder::loadMapFromData(const std::vector<int> &data, int width, int he
     return loadMapFromGrid(grid);
 }
 
+bool PathFinder::loadTerrainFromData(const int *data, int width, int height)
+{
+    if (data == nullptr || width <= 0 || height <= 0)
+    {
+        std::cerr << "Error: Invalid terrain buffer" << std::endl;
+        return false;
+    }
+
+    battleMap.width = width;
+    battleMap.height = height;
+    battleMap.grid.assign(height, std::vector<int>(width));
+    battleMap.hasValidStart = false;
+    battleMap.hasValidTarget = false;
+    battleMap.allStartPositions.clear();
+    battleMap.allTargetPositions.clear();
+    markMapReloaded();
+
+    // Markers are optional here; record any that are present without console output
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            int tile = data[y * width + x];
+            battleMap.grid[y][x] = tile;
+            if (tile == 0)
+                battleMap.allStartPositions.emplace_back(x, y);
+            else if (tile == 8)
+                battleMap.allTargetPositions.emplace_back(x, y);
+        }
+    }
+
+    if (!battleMap.allStartPositions.empty())
+    {
+        battleMap.startPos = battleMap.allStartPositions[0];
+        battleMap.hasValidStart = true;
+    }
+    if (!battleMap.allTargetPositions.empty())
+    {
+        battleMap.targetPos = battleMap.allTargetPositions[0];
+        battleMap.hasValidTarget = true;
+    }
+
+    return true;
+}
+
+void PathFinder::markMapReloaded()
+{
+    mapVersion++;
+    tileChanges.clear();
+    journalStartVersion = mapVersion;
+}
+
+bool PathFinder::setTile(int x, int y, int value)
+{
+    if (!isMapLoaded() || !battleMap.isValidPosition(x, y))
+        return false;
+    if (battleMap.grid[y][x] == value)
+        return true;
+
+    bool wasReachable = battleMap.isReachable(x, y);
+    battleMap.grid[y][x] = value;
+    bool nowReachable = battleMap.isReachable(x, y);
+    mapVersion++;
+
+    if (wasReachable != nowReachable)
+    {
+        TileChange change = {mapVersion, y * battleMap.width + x, nowReachable};
+        tileChanges.push_back(change);
+        if (tileChanges.size() > MAX_TILE_CHANGES)
+        {
+            journalStartVersion = tileChanges.front().version;
+            tileChanges.pop_front();
+        }
+    }
+    return true;
+}
+
 std::vector<Position> PathFinder::findPathAStar()
 {
     return findPathAStar(battleMap.startPos, battleMap.targetPos);
@@ -412,17 +505,21 @@ std::vector<Position> PathFinder::findPathAStar(const Position &start, const Pos
         return {};
     }
 
+    lastSearchStats = SearchStats();
+
     std::priority_queue<std::shared_ptr<Node>, std::vector<std::shared_ptr<Node>>, NodeComparator> openSet;
     std::unordered_set<Position, PositionHash> closedSet;
     std::unordered_set<Position, PositionHash> openSetPositions;
+    bool prune = pruningApplies(start, target);
+    int startIndex = start.y * battleMap.width + start.x;
+    int targetIndex = target.y * battleMap.width + target.x;
 
     // Start node
     auto startNode = std::make_shared<Node>(start, 0.0, calculateHeuristic(start, target));
 
     openSet.push(startNode);
     openSetPositions.insert(start);
-
-    int nodesExplored = 0;
+    lastSearchStats.nodesGenerated++;
 
     while (!openSet.empty())
     {
@@ -430,11 +527,12 @@ std::vector<Position> PathFinder::findPathAStar(const Position &start, const Pos
         openSet.pop();
         openSetPositions.erase(current->pos);
 
-        nodesExplored++;
+        lastSearchStats.nodesExpanded++;
 
         // Check if we reached the target
         if (current->pos == target)
         {
+            lastSearchStats.pathCost = static_cast<int>(current->gCost);
             return reconstructPath(current);
         }
 
@@ -448,6 +546,10 @@ std::vector<Position> PathFinder::findPathAStar(const Position &start, const Pos
             {
                 continue; // Skip if already evaluated
             }
+            if (prune && pruning->isPruned(neighbor.y * battleMap.width + neighbor.x, startIndex, targetIndex))
+            {
+                continue; // Dead end or swamp that no shortest path needs
+            }
 
             double tentativeGCost = current->gCost + 1.0; // Movement cost is 1
 
@@ -461,6 +563,7 @@ std::vector<Position> PathFinder::findPathAStar(const Position &start, const Pos
                     current);
                 openSet.push(neighborNode);
                 openSetPositions.insert(neighbor);
+                lastSearchStats.nodesGenerated++;
             }
         }
     }
@@ -468,6 +571,406 @@ std::vector<Position> PathFinder::findPathAStar(const Position &start, const Pos
     return {}; // No path found
 }
 
+std::vector<Position> PathFinder::searchRejoiningTail(const Position &start, const Position &target,
+                                                      const std::vector<Position> *tail, int tailFrom)
+{
+    lastSearchStats = SearchStats();
+    if (!battleMap.isReachable(start.x, start.y) || !battleMap.isReachable(target.x, target.y))
+        return {};
+
+    int width = battleMap.width;
+    int targetIndex = target.y * width + target.x;
+    int tailEnd = tail ? static_cast<int>(tail->size()) - 1 : 0;
+
+    // Usable tail waypoints with their exact remaining distance
+    std::unordered_map<int, int> tailOffsets;
+    if (tail)
+    {
+        for (int k = std::max(0, tailFrom + 1); k <= tailEnd; ++k)
+        {
+            tailOffsets[(*tail)[k].y * width + (*tail)[k].x] = k;
+        }
+    }
+
+    auto heuristic = [&](int index)
+    {
+        auto onTail = tailOffsets.find(index);
+        if (onTail != tailOffsets.end())
+            return tailEnd - onTail->second;
+        return std::abs(index % width - target.x) + std::abs(index / width - target.y);
+    };
+
+    // Sparse state: repairs usually touch a small part of the map
+    std::unordered_map<int, int> gCost;
+    std::unordered_map<int, int> parent;
+    std::unordered_set<int> closed;
+    typedef std::pair<std::pair<int, int>, int> Entry; // ((f, h), index)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    int startIndex = start.y * width + start.x;
+    gCost[startIndex] = 0;
+    parent[startIndex] = -1;
+    open.push(Entry(std::make_pair(heuristic(startIndex), heuristic(startIndex)), startIndex));
+    lastSearchStats.nodesGenerated = 1;
+
+    int reached = -1;
+    while (!open.empty())
+    {
+        int current = open.top().second;
+        open.pop();
+        if (!closed.insert(current).second)
+            continue;
+        lastSearchStats.nodesExpanded++;
+
+        // The target, or an intact waypoint whose remaining path is known
+        if (current == targetIndex || tailOffsets.count(current))
+        {
+            reached = current;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int nextCost = gCost[current] + 1;
+        for (const auto &direction : moveDirections)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!battleMap.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            if (closed.count(neighbor))
+                continue;
+            auto known = gCost.find(neighbor);
+            if (known != gCost.end() && known->second <= nextCost)
+                continue;
+
+            gCost[neighbor] = nextCost;
+            parent[neighbor] = current;
+            int h = heuristic(neighbor);
+            open.push(Entry(std::make_pair(nextCost + h, h), neighbor));
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (reached < 0)
+        return {};
+
+    std::vector<Position> path;
+    for (int index = reached; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    std::reverse(path.begin(), path.end());
+
+    if (reached != targetIndex)
+    {
+        // Splice the remainder of the cached path after the rejoin waypoint
+        path.insert(path.end(), tail->begin() + tailOffsets[reached] + 1, tail->end());
+    }
+
+    lastSearchStats.pathCost = calculatePathLength(path);
+    return path;
+}
+
+std::vector<Position> PathFinder::findPathAStarWithReuse(const Position &start, const Position &target,
+                                                         PathReuseCache &cache)
+{
+    if (!isMapLoaded())
+    {
+        std::cerr << "Error: No battle map loaded" << std::endl;
+        return {};
+    }
+
+    int width = battleMap.width;
+    auto onPath = cache.offsets.end();
+    if (!cache.path.empty() && cache.target == target && battleMap.isValidPosition(start.x, start.y))
+        onPath = cache.offsets.find(start.y * width + start.x);
+
+    if (onPath != cache.offsets.end())
+    {
+        int offset = onPath->second;
+        int lastIndex = static_cast<int>(cache.path.size()) - 1;
+
+        // Only blocked tiles since the cached path was made allow reuse
+        bool reusable = cache.mapVersion >= journalStartVersion;
+        int firstDamaged = -1;
+        int lastDamaged = -1;
+        for (auto change = tileChanges.rbegin(); reusable && change != tileChanges.rend(); ++change)
+        {
+            if (change->version <= cache.mapVersion)
+                break;
+            if (change->opened)
+            {
+                reusable = false; // A shortcut may have appeared
+                break;
+            }
+            auto hit = cache.offsets.find(change->index);
+            if (hit != cache.offsets.end() && hit->second >= offset)
+            {
+                if (hit->second == offset || hit->second == lastIndex)
+                    reusable = false; // Start or target itself is blocked
+                firstDamaged = firstDamaged < 0 ? hit->second : std::min(firstDamaged, hit->second);
+                lastDamaged = std::max(lastDamaged, hit->second);
+            }
+        }
+
+        if (reusable && firstDamaged < 0)
+        {
+            lastSearchStats = SearchStats();
+            lastSearchStats.pathCost = lastIndex - offset;
+            cache.mapVersion = mapVersion;
+            cache.lastOutcome = PathReuseOutcome::SUFFIX;
+            return std::vector<Position>(cache.path.begin() + offset, cache.path.end());
+        }
+
+        if (reusable)
+        {
+            std::vector<Position> repaired = searchRejoiningTail(start, target, &cache.path, lastDamaged);
+            if (!repaired.empty())
+            {
+                cache.path = repaired;
+                cache.lastOutcome = PathReuseOutcome::REPAIRED;
+                cache.mapVersion = mapVersion;
+                cache.offsets.clear();
+                for (size_t i = 0; i < cache.path.size(); ++i)
+                    cache.offsets[cache.path[i].y * width + cache.path[i].x] = static_cast<int>(i);
+                return repaired;
+            }
+        }
+    }
+
+    std::vector<Position> path = searchRejoiningTail(start, target, nullptr, 0);
+    cache.path = path;
+    cache.target = target;
+    cache.mapVersion = mapVersion;
+    cache.lastOutcome = PathReuseOutcome::FULL_SEARCH;
+    cache.offsets.clear();
+    for (size_t i = 0; i < cache.path.size(); ++i)
+        cache.offsets[cache.path[i].y * width + cache.path[i].x] = static_cast<int>(i);
+    return path;
+}
+
+std::vector<Position> PathFinder::findPathWeightedAStar(const Position &start, const Position &target, double weight)
+{
+    if (!isMapLoaded())
+    {
+        std::cerr << "Error: No battle map loaded" << std::endl;
+        return {};
+    }
+
+    lastSearchStats = SearchStats();
+    if (!battleMap.isReachable(start.x, start.y) || !battleMap.isReachable(target.x, target.y))
+        return {};
+
+    double w = std::max(1.0, weight);
+    int width = battleMap.width;
+    int targetIndex = target.y * width + target.x;
+    auto heuristic = [&](int index)
+    {
+        return std::abs(index % width - target.x) + std::abs(index / width - target.y);
+    };
+    const std::vector<uint16_t> *extraCosts =
+        tileCosts && tileCosts->size() == static_cast<size_t>(width) * battleMap.height ? tileCosts : nullptr;
+
+    std::unordered_map<int, int> gCost;
+    std::unordered_map<int, int> parent;
+    std::unordered_set<int> closed;
+    typedef std::pair<std::pair<double, int>, int> Entry; // ((g + w * h, -g), index)
+    std::vector<Entry> open;
+    std::greater<Entry> later;
+
+    int startIndex = start.y * width + start.x;
+    gCost[startIndex] = 0;
+    parent[startIndex] = -1;
+    open.push_back(Entry(std::make_pair(w * heuristic(startIndex), 0), startIndex));
+    lastSearchStats.nodesGenerated = 1;
+
+    bool found = false;
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end(), later);
+        Entry entry = open.back();
+        open.pop_back();
+        int current = entry.second;
+        if (-entry.first.second != gCost[current] || closed.count(current))
+            continue; // Superseded by a cheaper route
+
+        closed.insert(current);
+        lastSearchStats.nodesExpanded++;
+        if (current == targetIndex)
+        {
+            found = true;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int currentCost = gCost[current];
+        for (const auto &direction : moveDirections)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!battleMap.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            int nextCost = currentCost + 1 + (extraCosts ? (*extraCosts)[neighbor] : 0);
+            auto known = gCost.find(neighbor);
+            if (known != gCost.end() && known->second <= nextCost)
+                continue;
+
+            // Reopen closed tiles so the open list keeps bounding the optimal cost
+            closed.erase(neighbor);
+            gCost[neighbor] = nextCost;
+            parent[neighbor] = current;
+            open.push_back(Entry(std::make_pair(nextCost + w * heuristic(neighbor), -nextCost), neighbor));
+            std::push_heap(open.begin(), open.end(), later);
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (!found)
+        return {};
+
+    // The cheapest g + h still open bounds the optimal cost from below
+    int pathCost = gCost[targetIndex];
+    int lowerBound = pathCost;
+    for (const Entry &entry : open)
+    {
+        int index = entry.second;
+        if (-entry.first.second == gCost[index] && !closed.count(index))
+            lowerBound = std::min(lowerBound, gCost[index] + heuristic(index));
+    }
+
+    std::vector<Position> path;
+    for (int index = targetIndex; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    std::reverse(path.begin(), path.end());
+
+    lastSearchStats.pathCost = pathCost;
+    lastSearchStats.costLowerBound = lowerBound;
+    lastSearchStats.costRatio = lowerBound > 0 ? static_cast<double>(pathCost) / lowerBound : 1.0;
+    return path;
+}
+
+std::vector<Position> PathFinder::findPathFocal(const Position &start, const Position &target, double weight)
+{
+    if (!isMapLoaded())
+    {
+        std::cerr << "Error: No battle map loaded" << std::endl;
+        return {};
+    }
+
+    lastSearchStats = SearchStats();
+    if (!battleMap.isReachable(start.x, start.y) || !battleMap.isReachable(target.x, target.y))
+        return {};
+
+    double w = std::max(1.0, weight);
+    int width = battleMap.width;
+    int targetIndex = target.y * width + target.x;
+    auto heuristic = [&](int index)
+    {
+        return std::abs(index % width - target.x) + std::abs(index / width - target.y);
+    };
+
+    std::unordered_map<int, int> gCost;
+    std::unordered_map<int, int> parent;
+    std::unordered_set<int> closed;
+    std::set<std::pair<int, int>> openByF;       // (f, index)
+    std::set<std::tuple<int, int, int>> focal;   // (h, -g, index) for open tiles with f <= focalBound
+    int focalBound = -1;
+
+    int startIndex = start.y * width + start.x;
+    gCost[startIndex] = 0;
+    parent[startIndex] = -1;
+    openByF.insert(std::make_pair(heuristic(startIndex), startIndex));
+    lastSearchStats.nodesGenerated = 1;
+
+    int lowerBound = -1;
+    while (!openByF.empty())
+    {
+        // fmin never decreases with a consistent heuristic, so the focal list only grows into open
+        int fMin = openByF.begin()->first;
+        int bound = static_cast<int>(std::floor(w * fMin + 1e-9));
+        if (bound > focalBound)
+        {
+            auto first = openByF.upper_bound(std::make_pair(focalBound, INT_MAX));
+            for (auto it = first; it != openByF.end() && it->first <= bound; ++it)
+            {
+                focal.insert(std::make_tuple(heuristic(it->second), -gCost[it->second], it->second));
+            }
+            focalBound = bound;
+        }
+
+        int current = std::get<2>(*focal.begin());
+        focal.erase(focal.begin());
+        openByF.erase(std::make_pair(gCost[current] + heuristic(current), current));
+        closed.insert(current);
+        lastSearchStats.nodesExpanded++;
+
+        if (current == targetIndex)
+        {
+            lowerBound = fMin;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int nextCost = gCost[current] + 1;
+        for (const auto &direction : moveDirections)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!battleMap.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            int h = heuristic(neighbor);
+            auto known = gCost.find(neighbor);
+            if (known != gCost.end())
+            {
+                if (known->second <= nextCost)
+                    continue;
+                if (!closed.erase(neighbor))
+                {
+                    // Decrease-key: drop the open entries with the old cost
+                    int oldF = known->second + h;
+                    openByF.erase(std::make_pair(oldF, neighbor));
+                    if (oldF <= focalBound)
+                        focal.erase(std::make_tuple(h, -known->second, neighbor));
+                }
+            }
+
+            gCost[neighbor] = nextCost;
+            parent[neighbor] = current;
+            openByF.insert(std::make_pair(nextCost + h, neighbor));
+            if (nextCost + h <= focalBound)
+                focal.insert(std::make_tuple(h, -nextCost, neighbor));
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (lowerBound < 0)
+        return {};
+
+    std::vector<Position> path;
+    for (int index = targetIndex; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % width, index / width));
+    }
+    std::reverse(path.begin(), path.end());
+
+    int pathCost = gCost[targetIndex];
+    lastSearchStats.pathCost = pathCost;
+    lastSearchStats.costLowerBound = lowerBound;
+    lastSearchStats.costRatio = lowerBound > 0 ? static_cast<double>(pathCost) / lowerBound : 1.0;
+    return path;
+}
+
 std::vector<Position> PathFinder::findPathBFS(const Position &start, const Position &target)
 {
     if (!isMapLoaded())
@@ -476,23 +979,31 @@ std::vector<Position> PathFinder::findPathBFS(const Position &start, const Posit
         return {};
     }
 
+    lastSearchStats = SearchStats();
+
     std::queue<std::shared_ptr<Node>> openQueue;
     std::unordered_set<Position, PositionHash> visited;
+    bool prune = pruningApplies(start, target);
+    int startIndex = start.y * battleMap.width + start.x;
+    int targetIndex = target.y * battleMap.width + target.x;
 
     // Start node
     auto startNode = std::make_shared<Node>(start, 0.0, 0.0);
 
     openQueue.push(startNode);
     visited.insert(start);
+    lastSearchStats.nodesGenerated++;
 
     while (!openQueue.empty())
     {
         auto current = openQueue.front();
         openQueue.pop();
+        lastSearchStats.nodesExpanded++;
 
         // Check if we reached the target
         if (current->pos == target)
         {
+            lastSearchStats.pathCost = static_cast<int>(current->gCost);
             return reconstructPath(current);
         }
 
@@ -500,6 +1011,10 @@ std::vector<Position> PathFinder::findPathBFS(const Position &start, const Posit
         std::vector<Position> neighbors = getNeighbors(current->pos);
         for (const Position &neighbor : neighbors)
         {
+            if (prune && pruning->isPruned(neighbor.y * battleMap.width + neighbor.x, startIndex, targetIndex))
+            {
+                continue; // Dead end or swamp that no shortest path needs
+            }
             if (visited.find(neighbor) == visited.end())
             {
                 visited.insert(neighbor);
@@ -510,6 +1025,7 @@ std::vector<Position> PathFinder::findPathBFS(const Position &start, const Posit
                     0.0,
                     current);
                 openQueue.push(neighborNode);
+                lastSearchStats.nodesGenerated++;
             }
         }
     }
@@ -525,11 +1041,14 @@ std::vector<Position> PathFinder::findPathDFS(const Position &start, const Posit
         return {};
     }
 
+    lastSearchStats = SearchStats();
+
     std::stack<std::vector<Position>> pathStack;
     std::unordered_set<Position, PositionHash> visited;
 
     // Start with initial path containing only start position
     pathStack.push({start});
+    lastSearchStats.nodesGenerated++;
 
     int maxPathLength = battleMap.width * battleMap.height; // Prevent infinite loops
 
@@ -543,6 +1062,7 @@ std::vector<Position> PathFinder::findPathDFS(const Position &start, const Posit
         // Check if we reached the target
         if (currentPos == target)
         {
+            lastSearchStats.pathCost = calculatePathLength(currentPath);
             return currentPath;
         }
 
@@ -558,6 +1078,7 @@ std::vector<Position> PathFinder::findPathDFS(const Position &start, const Posit
             continue;
         }
         visited.insert(currentPos);
+        lastSearchStats.nodesExpanded++;
 
         // Explore neighbors in REVERSE ORDER for DFS stack behavior
         std::vector<Position> neighbors = getNeighbors(currentPos);
@@ -581,6 +1102,7 @@ std::vector<Position> PathFinder::findPathDFS(const Position &start, const Posit
                 std::vector<Position> newPath = currentPath;
                 newPath.push_back(neighbor);
                 pathStack.push(newPath);
+                lastSearchStats.nodesGenerated++;
             }
         }
     }
@@ -663,6 +1185,12 @@ std::vector<Position> PathFinder::reconstructPath(std::shared_ptr<Node> node) co
     return path;
 }
 
+bool PathFinder::pruningApplies(const Position &start, const Position &target) const
+{
+    return pruning && pruning->isCurrentFor(*this) &&
+           battleMap.isValidPosition(start.x, start.y) && battleMap.isValidPosition(target.x, target.y);
+}
+
 bool PathFinder::isPositionInSet(const Position &pos, const std::unordered_set<Position, PositionHash> &posSet) const
 {
     return posSet.find(pos) != posSet.end();
@@ -670,7 +1198,12 @@ bool PathFinder::isPositionInSet(const Position &pos, const std::unordered_set<P
 
 bool PathFinder::isMapLoaded() const
 {
-    return !battleMap.allStartPositions.empty() && !battleMap.allTargetPositions.empty() && !battleMap.grid.empty();
+    return !battleMap.grid.empty();
+}
+
+const SearchStats &PathFinder::getLastSearchStats() const
+{
+    return lastSearchStats;
 }
 
 const BattleMap &PathFinder::getBattleMap() const
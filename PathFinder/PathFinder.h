@@ -17,13 +17,18 @@
 
 #include <vector>
 #include <queue>
+#include <deque>
 #include <unordered_set>
+#include <unordered_map>
 #include <memory>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <set>
 #include <functional>
 
+class PathFinder;
+
 /**
  * @brief Represents a 2D position on the battle map
  *
@@ -201,6 +206,91 @@ struct BattleMap
     Position getTargetPosition(int index) const;
 };
 
+/**
+ * @brief Statistics collected by the most recent single-unit search
+ *
+ * Filled in by every PathFinder search call so callers (benchmarks, batch
+ * tools, servers) can report search effort without timing internals.
+ */
+struct SearchStats
+{
+    int nodesExpanded;  ///< Nodes removed from the open list and expanded
+    int nodesGenerated; ///< Nodes pushed onto the open list
+    int pathCost;       ///< Cost of the returned path, or -1 if none was found
+    int costLowerBound; ///< Proven lower bound on the optimal cost (bounded searches), or -1
+    double costRatio;   ///< pathCost / costLowerBound (bounded searches), or 0 if not computed
+
+    /**
+     * @brief Default constructor initializing empty statistics
+     */
+    SearchStats() : nodesExpanded(0), nodesGenerated(0), pathCost(-1), costLowerBound(-1), costRatio(0.0) {}
+};
+
+/**
+ * @brief How PathFinder::findPathAStarWithReuse() answered its last request
+ */
+enum class PathReuseOutcome
+{
+    FULL_SEARCH, ///< No usable cached path; a new search was run
+    SUFFIX,      ///< The start lay on the cached path; its remainder was returned without searching
+    REPAIRED     ///< Tiles on the cached path were blocked; a local search rejoined the intact tail
+};
+
+/**
+ * @brief Per-unit memory of the last path, used by PathFinder::findPathAStarWithReuse()
+ *
+ * Each unit keeps its own cache. The PathFinder only reads and refreshes it.
+ */
+struct PathReuseCache
+{
+    std::vector<Position> path;           ///< Last path returned for this unit
+    std::unordered_map<int, int> offsets; ///< Tile index (y * width + x) -> index in path
+    Position target;                      ///< Target of the cached path
+    uint64_t mapVersion;                  ///< Map version the path was computed or checked on
+    PathReuseOutcome lastOutcome;         ///< How the most recent request was answered
+
+    /**
+     * @brief Default constructor initializing an empty cache
+     */
+    PathReuseCache() : mapVersion(0), lastOutcome(PathReuseOutcome::FULL_SEARCH) {}
+
+    /**
+     * @brief Drop the cached path
+     */
+    void clear()
+    {
+        path.clear();
+        offsets.clear();
+    }
+};
+
+/**
+ * @brief Tiles findPathAStar() and findPathBFS() may skip, see PathFinder::setPruning()
+ *
+ * Implemented by preprocessing passes such as DeadEndPruning. Implementations
+ * must be safe to query from several threads once built.
+ */
+class SearchPruner
+{
+public:
+    virtual ~SearchPruner() {}
+
+    /**
+     * @brief Check whether the pruning describes an engine's current map
+     * @param engine The engine about to search
+     */
+    virtual bool isCurrentFor(const PathFinder &engine) const = 0;
+
+    /**
+     * @brief Check whether a search from start to target may skip a tile
+     * @param index Tile index (y * width + x)
+     * @param startIndex Start tile index
+     * @param targetIndex Target tile index
+     * @return true if no shortest path between start and target needs the tile
+     */
+    virtual bool isPruned(int index, int startIndex, int targetIndex) const = 0;
+};
+
 /**
  * @brief Advanced pathfinding engine for tactical battle map navigation
  *
@@ -287,10 +377,42 @@ private:
         }
     };
 
+    /**
+     * @brief Reachability change of one tile, kept for local path repair
+     */
+    struct TileChange
+    {
+        uint64_t version; ///< Map version created by the change
+        int index;        ///< Tile index (y * width + x)
+        bool opened;      ///< true: became reachable; false: became blocked
+    };
+
 protected:
     BattleMap battleMap;                             ///< The loaded battle map
     std::vector<std::pair<int, int>> moveDirections; ///< Current movement direction order
     std::string currentMoveOrder;                    ///< String representation of move order
+    SearchStats lastSearchStats;                     ///< Statistics of the most recent search
+    uint64_t mapVersion;                             ///< Incremented by every map load and tile edit
+    std::deque<TileChange> tileChanges;              ///< Recent reachability changes, oldest first
+    uint64_t journalStartVersion;                    ///< Every change after this version is in tileChanges
+    const SearchPruner *pruning;                     ///< Regions A* and BFS may skip (null = none)
+    const std::vector<uint16_t> *tileCosts;          ///< Extra cost of entering each tile (null = none)
+
+    /**
+     * @brief Bump the map version after the whole map was replaced
+     */
+    void markMapReloaded();
+
+    /**
+     * @brief Optimal A* that may stop on the intact tail of a cached path
+     * @param start Start position
+     * @param target Target position
+     * @param tail Cached path whose waypoints after tailFrom are still valid (may be null)
+     * @param tailFrom Waypoints with a larger index are usable
+     * @return Path from start to target, empty if none exists
+     */
+    std::vector<Position> searchRejoiningTail(const Position &start, const Position &target,
+                                              const std::vector<Position> *tail, int tailFrom);
 
     /**
      * @brief Calculate Manhattan distance heuristic
@@ -340,6 +462,14 @@ protected:
      */
     bool isPositionInSet(const Position &pos, const std::unordered_set<Position, PositionHash> &posSet) const;
 
+    /**
+     * @brief Check whether a search between two tiles may use the pruning regions
+     * @param start Start position
+     * @param target Target position
+     * @return true if regions are set, describe the current map, and both tiles are on the map
+     */
+    bool pruningApplies(const Position &start, const Position &target) const;
+
     /**
      * @brief Parse and validate movement order string
      * @param moveOrder String containing direction characters (r,d,l,u)
@@ -386,6 +516,55 @@ public:
      */
     bool loadMapFromData(const std::vector<int> &data, int width, int height);
 
+    /**
+     * @brief Load terrain from a flat tile buffer without requiring start/target markers
+     * @param data Row-major tile values (width * height entries)
+     * @param width Map width in tiles
+     * @param height Map height in tiles
+     * @return true if the terrain was loaded
+     *
+     * Intended for embedding, where start and target positions are supplied per
+     * query rather than stored in the map. Prints nothing on success.
+     */
+    bool loadTerrainFromData(const int *data, int width, int height);
+
+    /**
+     * @brief Change a single tile of the loaded map
+     * @param x X-coordinate
+     * @param y Y-coordinate
+     * @param value New tile value (-1, 0 and 8 are reachable)
+     * @return false if no map is loaded or the position is outside the map
+     *
+     * Increments the map version. The start and target marker lists are not
+     * updated.
+     */
+    bool setTile(int x, int y, int value);
+
+    /**
+     * @brief Get the map version
+     * @return Counter incremented by every map load and every setTile() that changes a tile
+     */
+    uint64_t getMapVersion() const { return mapVersion; }
+
+    /**
+     * @brief Let findPathAStar() and findPathBFS() skip dead ends and swamps
+     * @param regions Regions built on this engine's map, e.g. a DeadEndPruning (must outlive its use), or null to stop pruning
+     *
+     * Copies of the engine share the regions. They are ignored while they do
+     * not describe the current map version, e.g. after setTile().
+     */
+    void setPruning(const SearchPruner *regions) { pruning = regions; }
+
+    /**
+     * @brief Add a per-tile cost to the moves of findPathWeightedAStar()
+     * @param extraCosts Row-major extra cost of entering each tile (must outlive its use), or null for unit costs
+     *
+     * Entering a tile costs 1 plus its extra cost, so the Manhattan heuristic
+     * stays admissible and the weight bound still holds. Copies of the engine
+     * share the plane. It is ignored while its size does not match the map.
+     */
+    void setTileCosts(const std::vector<uint16_t> *extraCosts) { tileCosts = extraCosts; }
+
     /**
      * @brief Set movement direction order
      * @param moveOrder String with 4 unique direction characters (r,d,l,u)
@@ -402,6 +581,15 @@ public:
      */
     std::string getMoveOrder() const;
 
+    /**
+     * @brief Get the movement directions in expansion order
+     * @return (dx, dy) offsets, one per direction of the current move order
+     *
+     * Lets search engines built on top of PathFinder expand neighbors in the
+     * same order as the built-in algorithms.
+     */
+    const std::vector<std::pair<int, int>> &getMoveDirections() const;
+
     /**
      * @brief Print current movement order to console
      *
@@ -442,6 +630,54 @@ public:
      */
     std::vector<Position> findPathAStar(const Position &start, const Position &target);
 
+    /**
+     * @brief Optimal A* that reuses the unit's previous path when possible
+     * @param start Current position of the unit
+     * @param target Target position
+     * @param cache The unit's path cache (read and refreshed)
+     * @return Path from start to target, empty if none exists
+     *
+     * - Start on the cached path and map unchanged: the remaining suffix is
+     *   returned without searching (the start is found with one hash lookup)
+     * - Only tiles were blocked since the cached path was made: if none lies on
+     *   the remaining path the suffix is returned, otherwise a local A* runs
+     *   from the start and stops at the first intact waypoint behind the
+     *   damage it reaches
+     * - Anything else (new target, start off the path, tiles opened, map
+     *   reloaded): a full search
+     *
+     * cache.lastOutcome tells which case applied.
+     */
+    std::vector<Position> findPathAStarWithReuse(const Position &start, const Position &target,
+                                                 PathReuseCache &cache);
+
+    /**
+     * @brief Weighted A*: expands by g + w * h for fewer expansions
+     * @param start Starting position
+     * @param target Target position
+     * @param weight Suboptimality bound w (values below 1 are treated as 1)
+     * @return Path at most w times longer than the shortest, empty if none exists
+     *
+     * Closed tiles are reopened when a cheaper route to them appears, so the
+     * open list always holds a lower bound on the optimal cost. The bound is
+     * reported in getLastSearchStats() as costLowerBound and costRatio; the
+     * ratio is an upper estimate of the real suboptimality. Costs include the
+     * extra tile costs set with setTileCosts().
+     */
+    std::vector<Position> findPathWeightedAStar(const Position &start, const Position &target, double weight);
+
+    /**
+     * @brief Focal search (A*epsilon): among open tiles with f <= w * fmin, expand the one closest to the target
+     * @param start Starting position
+     * @param target Target position
+     * @param weight Suboptimality bound w (values below 1 are treated as 1)
+     * @return Path at most w times longer than the shortest, empty if none exists
+     *
+     * fmin at termination is a lower bound on the optimal cost, so the
+     * reported costRatio never exceeds w.
+     */
+    std::vector<Position> findPathFocal(const Position &start, const Position &target, double weight);
+
     /**
      * @brief BFS pathfinding with custom start and target positions
      * @param start Starting position
@@ -458,9 +694,15 @@ public:
      */
     std::vector<Position> findPathDFS(const Position &start, const Position &target);
 
+    /**
+     * @brief Get statistics of the most recent search
+     * @return Const reference to the statistics of the last findPath* call
+     */
+    const SearchStats &getLastSearchStats() const;
+
     /**
      * @brief Check if a battle map is currently loaded
-     * @return true if map is loaded and valid
+     * @return true if a map or terrain-only map is loaded
      */
     bool isMapLoaded() const;
 
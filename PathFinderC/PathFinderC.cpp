@@ -0,0 +1,297 @@
+/**
+ * @file PathFinderC.cpp
+ * @brief Stable C API for embedding the pathfinding engines - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file implements the C interface declared in PathFinderC.h on top of
+ * PathFinder and MultiUnitPathFinder. Every entry point converts C arguments,
+ * runs the engine owned by the handle and copies results into caller buffers;
+ * no C++ exception is allowed to cross the boundary.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "PathFinderC.h"
+#include "../PathFinder/PathFinder.h"
+#include "../MultiUnitPathFinder/MultiUnitPathFinder.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(int) == sizeof(int32_t), "Tile buffers are passed to the engine without conversion");
+
+/**
+ * @brief Map handle: terrain plus the engines reused across calls
+ */
+struct pf_map
+{
+    std::vector<int> tiles;                     ///< Row-major terrain copy (for lazy engines)
+    int width, height;                          ///< Map dimensions
+    std::string moveOrder;                      ///< Neighbor expansion order of all engines
+    PathFinder pathfinder;                      ///< Single-unit engine
+    std::unique_ptr<MultiUnitPathFinder> multi; ///< Multi-unit engine, created on first use
+
+    pf_map() : width(0), height(0), moveOrder("rdlu") {}
+};
+
+namespace
+{
+    bool isInside(const pf_map *map, const pf_position &pos)
+    {
+        return pos.x >= 0 && pos.y >= 0 && pos.x < map->width && pos.y < map->height;
+    }
+
+    std::vector<Position> runSearch(PathFinder &pathfinder, int32_t algorithm, const pf_position &start,
+                                    const pf_position &target)
+    {
+        Position from(start.x, start.y);
+        Position to(target.x, target.y);
+        const BattleMap &battleMap = pathfinder.getBattleMap();
+        if (!battleMap.isReachable(from.x, from.y) || !battleMap.isReachable(to.x, to.y))
+        {
+            return std::vector<Position>(); // Blocked endpoints never have a path
+        }
+
+        switch (algorithm)
+        {
+        case PF_ALGO_BFS:
+            return pathfinder.findPathBFS(from, to);
+        case PF_ALGO_DFS:
+            return pathfinder.findPathDFS(from, to);
+        default:
+            return pathfinder.findPathAStar(from, to);
+        }
+    }
+
+    /**
+     * @brief Append a path to a flat output buffer if it fits
+     * @return true if the path was written
+     */
+    bool appendPath(const std::vector<Position> &path, pf_position *paths, int32_t capacity, int32_t &used)
+    {
+        int32_t length = static_cast<int32_t>(path.size());
+        bool fits = paths != nullptr && used + length <= capacity;
+        if (fits)
+        {
+            for (int32_t i = 0; i < length; ++i)
+            {
+                paths[used + i].x = path[i].x;
+                paths[used + i].y = path[i].y;
+            }
+        }
+        used += length;
+        return fits;
+    }
+
+    MultiUnitPathFinder &getMulti(pf_map *map)
+    {
+        if (!map->multi)
+        {
+            map->multi.reset(new MultiUnitPathFinder(map->moveOrder));
+            map->multi->setVerbose(false);
+            map->multi->loadTerrainFromData(map->tiles.data(), map->width, map->height);
+        }
+        return *map->multi;
+    }
+}
+
+extern "C"
+{
+    int32_t pf_api_version(void)
+    {
+        return PF_API_VERSION;
+    }
+
+    pf_map *pf_map_create(const int32_t *tiles, int32_t width, int32_t height)
+    {
+        if (tiles == nullptr || width <= 0 || height <= 0 || width > 65535 || height > 65535)
+            return nullptr;
+
+        try
+        {
+            std::unique_ptr<pf_map> map(new pf_map());
+            map->tiles.assign(tiles, tiles + static_cast<size_t>(width) * height);
+            map->width = width;
+            map->height = height;
+            if (!map->pathfinder.loadTerrainFromData(map->tiles.data(), width, height))
+                return nullptr;
+            return map.release();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    pf_map *pf_map_clone(const pf_map *map)
+    {
+        if (map == nullptr)
+            return nullptr;
+
+        try
+        {
+            std::unique_ptr<pf_map> copy(new pf_map());
+            copy->tiles = map->tiles;
+            copy->width = map->width;
+            copy->height = map->height;
+            copy->moveOrder = map->moveOrder;
+            copy->pathfinder = map->pathfinder;
+            return copy.release();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    void pf_map_destroy(pf_map *map)
+    {
+        delete map;
+    }
+
+    int32_t pf_map_width(const pf_map *map)
+    {
+        return map != nullptr ? map->width : 0;
+    }
+
+    int32_t pf_map_height(const pf_map *map)
+    {
+        return map != nullptr ? map->height : 0;
+    }
+
+    int32_t pf_map_set_move_order(pf_map *map, const char *move_order)
+    {
+        if (map == nullptr || move_order == nullptr || !PathFinder::isValidMoveOrder(move_order))
+            return PF_INVALID_ARGUMENT;
+
+        map->moveOrder = move_order;
+        map->pathfinder.setMoveOrder(map->moveOrder);
+        if (map->multi)
+            map->multi->setMoveOrder(map->moveOrder);
+        return PF_OK;
+    }
+
+    int32_t pf_find_path(pf_map *map, int32_t algorithm, pf_position start, pf_position target,
+                         pf_position *path, int32_t capacity, int32_t *length, int32_t *nodes_expanded)
+    {
+        if (map == nullptr || length == nullptr || capacity < 0 || algorithm < PF_ALGO_ASTAR || algorithm > PF_ALGO_DFS ||
+            !isInside(map, start) || !isInside(map, target))
+            return PF_INVALID_ARGUMENT;
+
+        try
+        {
+            std::vector<Position> found = runSearch(map->pathfinder, algorithm, start, target);
+            if (nodes_expanded != nullptr)
+                *nodes_expanded = map->pathfinder.getLastSearchStats().nodesExpanded;
+
+            int32_t used = 0;
+            bool fits = appendPath(found, path, capacity, used);
+            *length = used;
+            return fits || found.empty() ? PF_OK : PF_BUFFER_TOO_SMALL;
+        }
+        catch (...)
+        {
+            return PF_INTERNAL_ERROR;
+        }
+    }
+
+    int32_t pf_find_paths_batch(pf_map *map, int32_t algorithm,
+                                const pf_position *starts, const pf_position *targets, int32_t count,
+                                pf_position *paths, int32_t capacity,
+                                int32_t *offsets, int32_t *lengths, int32_t *required)
+    {
+        if (map == nullptr || count < 0 || capacity < 0 || algorithm < PF_ALGO_ASTAR || algorithm > PF_ALGO_DFS ||
+            (count > 0 && (starts == nullptr || targets == nullptr || offsets == nullptr || lengths == nullptr)))
+            return PF_INVALID_ARGUMENT;
+
+        try
+        {
+            int32_t used = 0;
+            bool allFit = true;
+            for (int32_t i = 0; i < count; ++i)
+            {
+                std::vector<Position> found;
+                if (isInside(map, starts[i]) && isInside(map, targets[i]))
+                    found = runSearch(map->pathfinder, algorithm, starts[i], targets[i]);
+
+                offsets[i] = used;
+                lengths[i] = static_cast<int32_t>(found.size());
+                if (!appendPath(found, paths, capacity, used) && !found.empty())
+                    allFit = false;
+            }
+
+            if (required != nullptr)
+                *required = used;
+            return allFit ? PF_OK : PF_BUFFER_TOO_SMALL;
+        }
+        catch (...)
+        {
+            return PF_INTERNAL_ERROR;
+        }
+    }
+
+    int32_t pf_solve_multi(pf_map *map, int32_t strategy,
+                           const pf_position *starts, const pf_position *targets, int32_t count,
+                           pf_position *paths, int32_t capacity,
+                           int32_t *offsets, int32_t *lengths, int32_t *required, int32_t *all_found)
+    {
+        if (map == nullptr || count <= 0 || capacity < 0 || strategy < PF_STRATEGY_SEQUENTIAL || strategy > PF_STRATEGY_WAIT ||
+            starts == nullptr || targets == nullptr || offsets == nullptr || lengths == nullptr)
+            return PF_INVALID_ARGUMENT;
+
+        for (int32_t i = 0; i < count; ++i)
+        {
+            if (!isInside(map, starts[i]) || !isInside(map, targets[i]))
+                return PF_INVALID_ARGUMENT;
+        }
+
+        try
+        {
+            static const ConflictResolutionStrategy strategies[] = {
+                ConflictResolutionStrategy::SEQUENTIAL, ConflictResolutionStrategy::PRIORITY_BASED,
+                ConflictResolutionStrategy::COOPERATIVE, ConflictResolutionStrategy::WAIT_AND_RETRY};
+
+            MultiUnitPathFinder &multi = getMulti(map);
+            multi.clearUnits();
+            for (int32_t i = 0; i < count; ++i)
+            {
+                multi.addUnit(i, Position(starts[i].x, starts[i].y), Position(targets[i].x, targets[i].y));
+            }
+            multi.setConflictResolutionStrategy(strategies[strategy]);
+
+            PathfindingResult result = multi.findPathsForAllUnits();
+
+            // Strategies may reorder units; answer in request order using unit ids
+            std::vector<const Unit *> byId(count, nullptr);
+            for (const auto &unit : result.units)
+            {
+                if (unit.id >= 0 && unit.id < count)
+                    byId[unit.id] = &unit;
+            }
+
+            int32_t used = 0;
+            bool allFit = true;
+            static const std::vector<Position> noPath;
+            for (int32_t i = 0; i < count; ++i)
+            {
+                const std::vector<Position> &found = (byId[i] != nullptr && byId[i]->pathFound) ? byId[i]->path : noPath;
+                offsets[i] = used;
+                lengths[i] = static_cast<int32_t>(found.size());
+                if (!appendPath(found, paths, capacity, used) && !found.empty())
+                    allFit = false;
+            }
+
+            if (required != nullptr)
+                *required = used;
+            if (all_found != nullptr)
+                *all_found = result.allPathsFound ? 1 : 0;
+            return allFit ? PF_OK : PF_BUFFER_TOO_SMALL;
+        }
+        catch (...)
+        {
+            return PF_INTERNAL_ERROR;
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file PathFinderC.h
+ * @brief Stable C API for embedding the pathfinding engines - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header declares the C interface exported by libpathfinder.so. It lets a
+ * host process (for example a game server written in C, C++, Rust or Python via
+ * ctypes) create maps from its own tile buffers and run single, batch and
+ * multi-unit queries with results written into caller-provided arrays.
+ *
+ * @par ABI Rules:
+ * - Only fixed-width integers, plain structs and opaque handles cross the boundary
+ * - No function returns memory the caller must free, except pf_map_create()/pf_map_clone()
+ * - No C++ exceptions escape; failures are reported through status codes
+ * - PF_API_VERSION is bumped whenever a signature or struct layout changes
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef PATHFINDERC_H
+#define PATHFINDERC_H
+
+#include <stdint.h>
+
+#if defined(__GNUC__)
+#define PF_API __attribute__((visibility("default")))
+#else
+#define PF_API
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Version of the C ABI described by this header */
+#define PF_API_VERSION 1
+
+/* Status codes returned by every query function */
+#define PF_OK 0                 /**< Success (a path may still be absent, see lengths) */
+#define PF_INVALID_ARGUMENT 1   /**< Null handle/pointer, bad code or out-of-map position */
+#define PF_BUFFER_TOO_SMALL 2   /**< Output buffer too small; required size is reported */
+#define PF_INTERNAL_ERROR 3     /**< Unexpected engine failure */
+
+/* Single-unit algorithms */
+#define PF_ALGO_ASTAR 0 /**< A* with Manhattan heuristic (optimal) */
+#define PF_ALGO_BFS 1   /**< Breadth-first search (optimal) */
+#define PF_ALGO_DFS 2   /**< Depth-first search (not optimal) */
+
+/* Multi-unit conflict resolution strategies */
+#define PF_STRATEGY_SEQUENTIAL 0  /**< Units planned in order */
+#define PF_STRATEGY_PRIORITY 1    /**< Units planned by priority */
+#define PF_STRATEGY_COOPERATIVE 2 /**< Several unit orderings tried */
+#define PF_STRATEGY_WAIT 3        /**< Wait-and-retry */
+
+    /**
+     * @brief Tile coordinate, layout-compatible with two consecutive int32_t values
+     */
+    typedef struct pf_position
+    {
+        int32_t x; /**< Column */
+        int32_t y; /**< Row */
+    } pf_position;
+
+    /**
+     * @brief Opaque map handle owning the terrain and reusable search engines
+     *
+     * A handle is not thread-safe. Use one handle per thread; pf_map_clone()
+     * creates an independent copy cheaply from an existing handle.
+     */
+    typedef struct pf_map pf_map;
+
+    /**
+     * @brief Get the ABI version of the loaded library
+     * @return PF_API_VERSION the library was built with
+     */
+    PF_API int32_t pf_api_version(void);
+
+    /**
+     * @brief Create a map from a row-major tile buffer
+     * @param tiles width * height tile values (-1 ground, 0 start, 8 target, 3 blocked)
+     * @param width Map width in tiles
+     * @param height Map height in tiles
+     * @return New handle, or NULL on invalid input; release with pf_map_destroy()
+     *
+     * The buffer is copied; start/target markers are optional.
+     */
+    PF_API pf_map *pf_map_create(const int32_t *tiles, int32_t width, int32_t height);
+
+    /**
+     * @brief Create an independent copy of a map handle (e.g. one per worker thread)
+     * @param map Handle to copy
+     * @return New handle, or NULL on failure
+     */
+    PF_API pf_map *pf_map_clone(const pf_map *map);
+
+    /**
+     * @brief Destroy a map handle (NULL is ignored)
+     * @param map Handle to destroy
+     */
+    PF_API void pf_map_destroy(pf_map *map);
+
+    /**
+     * @brief Get map width in tiles (0 for NULL)
+     */
+    PF_API int32_t pf_map_width(const pf_map *map);
+
+    /**
+     * @brief Get map height in tiles (0 for NULL)
+     */
+    PF_API int32_t pf_map_height(const pf_map *map);
+
+    /**
+     * @brief Set the neighbor expansion order used by all engines of the handle
+     * @param map Map handle
+     * @param move_order Four characters, each of r, d, l, u exactly once (e.g. "uldr")
+     * @return PF_OK or PF_INVALID_ARGUMENT
+     */
+    PF_API int32_t pf_map_set_move_order(pf_map *map, const char *move_order);
+
+    /**
+     * @brief Find one path into a caller-provided buffer
+     * @param map Map handle
+     * @param algorithm PF_ALGO_* code
+     * @param start Start tile
+     * @param target Target tile
+     * @param path Output buffer of positions, start and target included (may be NULL if capacity is 0)
+     * @param capacity Number of positions path can hold
+     * @param length Receives the number of positions in the path (0 if no path exists)
+     * @param nodes_expanded Optional; receives the number of expanded nodes
+     * @return PF_OK, or PF_BUFFER_TOO_SMALL with *length set to the required capacity
+     */
+    PF_API int32_t pf_find_path(pf_map *map, int32_t algorithm, pf_position start, pf_position target,
+                                pf_position *path, int32_t capacity, int32_t *length, int32_t *nodes_expanded);
+
+    /**
+     * @brief Find many paths into one flat buffer
+     * @param map Map handle
+     * @param algorithm PF_ALGO_* code
+     * @param starts count start tiles
+     * @param targets count target tiles
+     * @param count Number of queries
+     * @param paths Output buffer receiving all paths back to back
+     * @param capacity Number of positions paths can hold
+     * @param offsets count entries; receives the index in paths where each path begins
+     * @param lengths count entries; receives each path's length (0 if no path exists)
+     * @param required Optional; receives the total number of positions written or needed
+     * @return PF_OK, or PF_BUFFER_TOO_SMALL after all queries ran (offsets/lengths stay valid
+     *         and *required holds the capacity needed to receive every path)
+     *
+     * Queries with an out-of-map endpoint yield length 0 instead of failing the batch.
+     */
+    PF_API int32_t pf_find_paths_batch(pf_map *map, int32_t algorithm,
+                                       const pf_position *starts, const pf_position *targets, int32_t count,
+                                       pf_position *paths, int32_t capacity,
+                                       int32_t *offsets, int32_t *lengths, int32_t *required);
+
+    /**
+     * @brief Plan collision-free paths for several units at once
+     * @param map Map handle
+     * @param strategy PF_STRATEGY_* code
+     * @param starts count unit start tiles
+     * @param targets count unit target tiles
+     * @param count Number of units
+     * @param paths Output buffer receiving all unit paths back to back, in unit order
+     * @param capacity Number of positions paths can hold
+     * @param offsets count entries; receives the index in paths where each unit's path begins
+     * @param lengths count entries; receives each unit's path length (0 if no path was found)
+     * @param required Optional; receives the total number of positions written or needed
+     * @param all_found Optional; receives 1 if every unit found a path, else 0
+     * @return PF_OK, PF_INVALID_ARGUMENT, or PF_BUFFER_TOO_SMALL as for pf_find_paths_batch()
+     *
+     * Paths share a common clock: position i of every path is the unit's tile at
+     * time step i, with waits encoded as repeated positions.
+     */
+    PF_API int32_t pf_solve_multi(pf_map *map, int32_t strategy,
+                                  const pf_position *starts, const pf_position *targets, int32_t count,
+                                  pf_position *paths, int32_t capacity,
+                                  int32_t *offsets, int32_t *lengths, int32_t *required, int32_t *all_found);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PATHFINDERC_H
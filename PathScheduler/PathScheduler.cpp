@@ -0,0 +1,359 @@
+/**
+ * @file PathScheduler.cpp
+ * @brief Prioritized, deduplicating path request scheduler - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the PathScheduler: request
+ * intake, grouping into shared jobs, execution on the task pool within the
+ * tick budget, and response delivery on the ticking thread.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "PathScheduler.h"
+#include <algorithm>
+#include <map>
+#include <set>
+
+PathScheduler::PathScheduler(const PathFinder &pathfinder, int maxParallelJobs, TaskPool &taskPool)
+    : pool(taskPool), parallelism(std::max(1, maxParallelJobs)), flowFieldThreshold(4)
+{
+    engines.assign(pool.size(), pathfinder);
+    distanceFields.resize(pool.size());
+}
+
+PathScheduler::~PathScheduler()
+{
+    // Never leave a future without a value
+    PathResponse expired;
+    expired.status = PathRequestStatus::EXPIRED;
+    for (auto &request : pending)
+    {
+        deliver(request, expired);
+    }
+}
+
+std::future<PathResponse> PathScheduler::submit(const Position &start, const Position &target, int priority,
+                                                Clock::time_point deadline)
+{
+    Request request;
+    request.start = start;
+    request.target = target;
+    request.priority = priority;
+    request.deadline = deadline;
+    request.promise = std::make_shared<std::promise<PathResponse>>();
+    std::future<PathResponse> future = request.promise->get_future();
+
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    pending.push_back(request);
+    stats.requestsSubmitted++;
+    return future;
+}
+
+void PathScheduler::submit(const Position &start, const Position &target, int priority,
+                           Clock::time_point deadline, const Callback &callback)
+{
+    Request request;
+    request.start = start;
+    request.target = target;
+    request.priority = priority;
+    request.deadline = deadline;
+    request.callback = callback;
+
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    pending.push_back(request);
+    stats.requestsSubmitted++;
+}
+
+void PathScheduler::setFlowFieldThreshold(size_t threshold)
+{
+    flowFieldThreshold = std::max<size_t>(2, threshold);
+}
+
+size_t PathScheduler::pendingCount()
+{
+    std::lock_guard<std::mutex> lock(pendingMutex);
+    return pending.size();
+}
+
+void PathScheduler::deliver(Request &request, const PathResponse &response)
+{
+    if (request.promise)
+        request.promise->set_value(response);
+    if (request.callback)
+        request.callback(response);
+}
+
+void PathScheduler::buildJobs(std::vector<Request> &requests, std::vector<Job> &jobs) const
+{
+    std::map<Position, std::vector<Request>, PositionComparator> byTarget;
+    for (auto &request : requests)
+    {
+        byTarget[request.target].push_back(std::move(request));
+    }
+
+    for (auto &group : byTarget)
+    {
+        std::map<Position, std::vector<Request>, PositionComparator> byStart;
+        for (auto &request : group.second)
+        {
+            byStart[request.start].push_back(std::move(request));
+        }
+
+        std::vector<Job> targetJobs;
+        if (byStart.size() >= flowFieldThreshold)
+        {
+            // One distance field from the target answers every start
+            Job job;
+            job.flowField = true;
+            job.target = group.first;
+            for (auto &starts : byStart)
+            {
+                for (auto &request : starts.second)
+                    job.requests.push_back(std::move(request));
+            }
+            targetJobs.push_back(std::move(job));
+        }
+        else
+        {
+            for (auto &starts : byStart)
+            {
+                Job job;
+                job.flowField = false;
+                job.target = group.first;
+                job.requests = std::move(starts.second);
+                targetJobs.push_back(std::move(job));
+            }
+        }
+
+        for (auto &job : targetJobs)
+        {
+            job.done = false;
+            job.priority = job.requests[0].priority;
+            job.deadline = job.requests[0].deadline;
+            for (const auto &request : job.requests)
+            {
+                job.priority = std::max(job.priority, request.priority);
+                job.deadline = std::min(job.deadline, request.deadline);
+            }
+            jobs.push_back(std::move(job));
+        }
+    }
+
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job &a, const Job &b)
+                     {
+                         if (a.priority != b.priority)
+                             return a.priority > b.priority;
+                         return a.deadline < b.deadline; });
+}
+
+std::vector<Position> PathScheduler::followDistanceField(const BattleMap &map,
+                                                         const std::vector<std::pair<int, int>> &moveDirections,
+                                                         const std::vector<int> &distance, const Position &start)
+{
+    std::vector<Position> path;
+    if (!map.isValidPosition(start.x, start.y) || distance[start.y * map.width + start.x] < 0)
+        return path;
+
+    Position current = start;
+    int remaining = distance[current.y * map.width + current.x];
+    path.reserve(remaining + 1);
+    path.push_back(current);
+
+    while (remaining > 0)
+    {
+        for (const auto &direction : moveDirections)
+        {
+            int nx = current.x + direction.first;
+            int ny = current.y + direction.second;
+            if (map.isValidPosition(nx, ny) && distance[ny * map.width + nx] == remaining - 1)
+            {
+                current = Position(nx, ny);
+                break;
+            }
+        }
+        remaining--;
+        path.push_back(current);
+    }
+
+    return path;
+}
+
+void PathScheduler::runJob(Job &job, int engineIndex)
+{
+    PathFinder &engine = engines[engineIndex];
+    const BattleMap &map = engine.getBattleMap();
+    bool shared = job.requests.size() > 1;
+    job.responses.assign(job.requests.size(), PathResponse());
+
+    if (!job.flowField)
+    {
+        PathResponse response;
+        const Position &start = job.requests[0].start;
+        if (!map.isReachable(start.x, start.y) || !map.isReachable(job.target.x, job.target.y))
+        {
+            response.status = PathRequestStatus::INVALID;
+        }
+        else
+        {
+            response.path = engine.findPathAStar(start, job.target);
+            response.nodesExpanded = engine.getLastSearchStats().nodesExpanded;
+            response.status = response.path.empty() ? PathRequestStatus::NO_PATH : PathRequestStatus::FOUND;
+        }
+        response.shared = shared;
+        job.responses.assign(job.requests.size(), response);
+        job.done = true;
+        return;
+    }
+
+    // Flow field: BFS from the target until every requested start is labelled
+    std::vector<int> &distance = distanceFields[engineIndex];
+    distance.assign(static_cast<size_t>(map.width) * map.height, -1);
+
+    std::set<Position, PositionComparator> unresolved;
+    for (const auto &request : job.requests)
+    {
+        if (map.isReachable(request.start.x, request.start.y))
+            unresolved.insert(request.start);
+    }
+
+    int expanded = 0;
+    if (map.isReachable(job.target.x, job.target.y))
+    {
+        const std::vector<std::pair<int, int>> &directions = engine.getMoveDirections();
+        std::vector<int> frontier(1, job.target.y * map.width + job.target.x);
+        distance[frontier[0]] = 0;
+
+        for (size_t head = 0; head < frontier.size() && !unresolved.empty(); ++head)
+        {
+            int index = frontier[head];
+            int x = index % map.width;
+            int y = index / map.width;
+            unresolved.erase(Position(x, y));
+            expanded++;
+
+            for (const auto &direction : directions)
+            {
+                int nx = x + direction.first;
+                int ny = y + direction.second;
+                if (!map.isReachable(nx, ny) || distance[ny * map.width + nx] >= 0)
+                    continue;
+                distance[ny * map.width + nx] = distance[index] + 1;
+                frontier.push_back(ny * map.width + nx);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < job.requests.size(); ++i)
+    {
+        const Request &request = job.requests[i];
+        PathResponse &response = job.responses[i];
+        response.shared = shared;
+        response.nodesExpanded = expanded;
+
+        if (!map.isReachable(request.start.x, request.start.y) || !map.isReachable(job.target.x, job.target.y))
+        {
+            response.status = PathRequestStatus::INVALID;
+            continue;
+        }
+
+        response.path = followDistanceField(map, engine.getMoveDirections(), distance, request.start);
+        response.status = response.path.empty() ? PathRequestStatus::NO_PATH : PathRequestStatus::FOUND;
+    }
+    job.done = true;
+}
+
+void PathScheduler::drainJobs(std::vector<Job> &jobs, std::atomic<size_t> &next, Clock::time_point deadline)
+{
+    int engineIndex = TaskPool::workerIndex();
+    while (true)
+    {
+        size_t index = next.fetch_add(1);
+        // The most urgent job always runs so every tick makes progress
+        if (index >= jobs.size() || (index > 0 && Clock::now() >= deadline))
+            break;
+        runJob(jobs[index], engineIndex);
+    }
+}
+
+size_t PathScheduler::tick(Clock::time_point budgetEnd)
+{
+    std::vector<Request> requests;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        requests.swap(pending);
+    }
+
+    size_t delivered = 0;
+    Clock::time_point now = Clock::now();
+
+    std::vector<Request> live;
+    live.reserve(requests.size());
+    for (auto &request : requests)
+    {
+        if (request.deadline < now)
+        {
+            PathResponse expired;
+            expired.status = PathRequestStatus::EXPIRED;
+            deliver(request, expired);
+            stats.requestsExpired++;
+            delivered++;
+        }
+        else
+        {
+            live.push_back(std::move(request));
+        }
+    }
+
+    std::vector<Job> jobs;
+    buildJobs(live, jobs);
+    if (jobs.empty())
+    {
+        stats.requestsAnswered += delivered;
+        return delivered;
+    }
+
+    std::atomic<size_t> next(0);
+    TaskGroup group(pool);
+    int lanes = static_cast<int>(std::min<size_t>(parallelism, jobs.size()));
+    for (int lane = 0; lane < lanes; ++lane)
+    {
+        group.run([this, &jobs, &next, budgetEnd]()
+                  { drainJobs(jobs, next, budgetEnd); });
+    }
+    group.wait();
+
+    std::vector<Request> carryOver;
+    for (auto &job : jobs)
+    {
+        if (!job.done)
+        {
+            for (auto &request : job.requests)
+                carryOver.push_back(std::move(request));
+            continue;
+        }
+
+        if (job.flowField)
+            stats.flowFieldsBuilt++;
+        else
+            stats.searchesRun++;
+        stats.requestsMerged += job.requests.size() - 1;
+
+        for (size_t i = 0; i < job.requests.size(); ++i)
+        {
+            deliver(job.requests[i], job.responses[i]);
+            delivered++;
+        }
+    }
+
+    if (!carryOver.empty())
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pending.insert(pending.begin(), carryOver.begin(), carryOver.end());
+    }
+
+    stats.requestsAnswered += delivered;
+    return delivered;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file PathScheduler.h
+ * @brief Prioritized, deduplicating path request scheduler - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the PathScheduler which sits in front of PathFinder.
+ * Requests carry a priority and a deadline; identical (start, target)
+ * requests share one search and many requests to the same target share one
+ * flow field. Work is executed on the shared TaskPool within a per-tick
+ * time budget, and callers are notified through futures or callbacks.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef PATHSCHEDULER_H
+#define PATHSCHEDULER_H
+
+#include "../PathFinder/PathFinder.h"
+#include "../TaskPool/TaskPool.h"
+#include <vector>
+#include <memory>
+#include <future>
+#include <functional>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+
+/**
+ * @brief Outcome of a scheduled path request
+ */
+enum class PathRequestStatus
+{
+    FOUND,    ///< Path found
+    NO_PATH,  ///< Endpoints valid but unconnected
+    INVALID,  ///< Start or target outside the map or blocked
+    EXPIRED   ///< Deadline passed before the request was served
+};
+
+/**
+ * @brief Answer delivered for one request
+ */
+struct PathResponse
+{
+    PathRequestStatus status;   ///< Outcome
+    std::vector<Position> path; ///< Path from start to target (empty unless FOUND)
+    int nodesExpanded;          ///< Expansions of the (possibly shared) computation
+    bool shared;                ///< True if the computation also answered other requests
+
+    /**
+     * @brief Default constructor initializing an empty NO_PATH response
+     */
+    PathResponse() : status(PathRequestStatus::NO_PATH), nodesExpanded(0), shared(false) {}
+};
+
+/**
+ * @brief Counters describing the scheduler's work so far
+ */
+struct SchedulerStats
+{
+    size_t requestsSubmitted; ///< Requests accepted by submit()
+    size_t requestsAnswered;  ///< Responses delivered (including expired)
+    size_t requestsExpired;   ///< Requests whose deadline passed
+    size_t searchesRun;       ///< Individual A* searches executed
+    size_t flowFieldsBuilt;   ///< Same-target flow fields computed
+    size_t requestsMerged;    ///< Requests that needed no computation of their own
+
+    /**
+     * @brief Default constructor initializing all counters to zero
+     */
+    SchedulerStats() : requestsSubmitted(0), requestsAnswered(0), requestsExpired(0),
+                       searchesRun(0), flowFieldsBuilt(0), requestsMerged(0) {}
+};
+
+/**
+ * @brief Request scheduler with priorities, deadlines and deduplication
+ *
+ * submit() may be called from any thread. tick() is called once per
+ * simulation tick, typically from the game loop; it groups pending requests,
+ * runs the most urgent work on the task pool until the tick budget is
+ * spent, and delivers responses (fulfilling futures and invoking callbacks)
+ * on the calling thread before returning. Work that did not fit carries over
+ * to the next tick.
+ *
+ * @par Grouping:
+ * - Requests with the same start and target share one A* search
+ * - When at least the flow-field threshold of distinct starts target the same
+ *   tile, one BFS distance field from the target answers all of them
+ * - Groups run in order of highest priority, then earliest deadline
+ *
+ * @par Usage Example:
+ * @code
+ * PathScheduler scheduler(pathfinder, 4);
+ * std::future<PathResponse> answer = scheduler.submit(unitPos, rallyPoint, 10);
+ * scheduler.submit(otherPos, rallyPoint, 5, PathScheduler::Clock::now() + std::chrono::seconds(1),
+ *                  [](const PathResponse &response) { ... });
+ * // Every tick:
+ * scheduler.tick(PathScheduler::Clock::now() + std::chrono::milliseconds(3));
+ * @endcode
+ */
+class PathScheduler
+{
+public:
+    typedef std::chrono::steady_clock Clock;                     ///< Clock used for deadlines
+    typedef std::function<void(const PathResponse &)> Callback; ///< Completion callback
+
+private:
+    /**
+     * @brief One submitted request waiting for an answer
+     */
+    struct Request
+    {
+        Position start;                                      ///< Start tile
+        Position target;                                     ///< Target tile
+        int priority;                                        ///< Higher is served first
+        Clock::time_point deadline;                          ///< Expire if not served by then
+        std::shared_ptr<std::promise<PathResponse>> promise; ///< Future side (may be null)
+        Callback callback;                                   ///< Callback side (may be empty)
+    };
+
+    /**
+     * @brief A unit of work answering one or more requests
+     */
+    struct Job
+    {
+        bool flowField;                      ///< true: BFS field from target; false: single A*
+        Position target;                     ///< Shared target
+        std::vector<Request> requests;       ///< Requests answered by this job
+        int priority;                        ///< Highest priority among the requests
+        Clock::time_point deadline;          ///< Earliest deadline among the requests
+        bool done;                           ///< Set by the worker that ran the job
+        std::vector<PathResponse> responses; ///< One per request once done
+    };
+
+    TaskPool &pool;                               ///< Pool executing the jobs
+    int parallelism;                              ///< Jobs run concurrently per tick
+    std::vector<PathFinder> engines;              ///< One engine per pool worker
+    std::vector<std::vector<int>> distanceFields; ///< Reusable BFS buffers per pool worker
+    size_t flowFieldThreshold;                    ///< Distinct starts per target that trigger a flow field
+
+    std::mutex pendingMutex;      ///< Guards pending
+    std::vector<Request> pending; ///< Requests not yet answered
+    SchedulerStats stats;         ///< Work counters
+
+    /**
+     * @brief Claim and run jobs until none are left or the deadline passes
+     * @param jobs Jobs of the current tick
+     * @param next Next job index to claim
+     * @param deadline Tick budget end (the first job always runs)
+     */
+    void drainJobs(std::vector<Job> &jobs, std::atomic<size_t> &next, Clock::time_point deadline);
+
+    /**
+     * @brief Execute one job
+     * @param job Job to run
+     * @param engineIndex Engine of the calling pool worker
+     */
+    void runJob(Job &job, int engineIndex);
+
+    /**
+     * @brief Group pending requests into jobs, ordered by urgency
+     * @param requests Requests to group (consumed)
+     * @param jobs Output jobs
+     */
+    void buildJobs(std::vector<Request> &requests, std::vector<Job> &jobs) const;
+
+    /**
+     * @brief Deliver a response to a request's future and/or callback
+     */
+    static void deliver(Request &request, const PathResponse &response);
+
+public:
+    /**
+     * @brief Create a scheduler over a loaded PathFinder
+     * @param pathfinder Engine with the map loaded (copied once per pool worker)
+     * @param maxParallelJobs Jobs executed concurrently during tick() (minimum 1)
+     * @param taskPool Pool executing the jobs
+     */
+    PathScheduler(const PathFinder &pathfinder, int maxParallelJobs = 1, TaskPool &taskPool = TaskPool::shared());
+
+    /**
+     * @brief Answer the requests still pending as EXPIRED
+     */
+    ~PathScheduler();
+
+    PathScheduler(const PathScheduler &) = delete;
+    PathScheduler &operator=(const PathScheduler &) = delete;
+
+    /**
+     * @brief Submit a request answered through a future
+     * @param start Start tile
+     * @param target Target tile
+     * @param priority Higher values are served first
+     * @param deadline Request expires if not served by this time
+     * @return Future receiving the response during a later tick()
+     */
+    std::future<PathResponse> submit(const Position &start, const Position &target, int priority = 0,
+                                     Clock::time_point deadline = Clock::time_point::max());
+
+    /**
+     * @brief Submit a request answered through a callback
+     * @param start Start tile
+     * @param target Target tile
+     * @param priority Higher values are served first
+     * @param deadline Request expires if not served by this time
+     * @param callback Invoked on the thread calling tick()
+     */
+    void submit(const Position &start, const Position &target, int priority,
+                Clock::time_point deadline, const Callback &callback);
+
+    /**
+     * @brief Serve pending requests until done or the tick budget is spent
+     * @param budgetEnd End of this tick's pathfinding budget
+     * @return Number of responses delivered
+     */
+    size_t tick(Clock::time_point budgetEnd);
+
+    /**
+     * @brief Set how many distinct starts toward one target trigger a flow field
+     * @param threshold Minimum distinct starts (default 4, at least 2); use SIZE_MAX to disable flow fields
+     */
+    void setFlowFieldThreshold(size_t threshold);
+
+    /**
+     * @brief Get the number of requests waiting for an answer
+     */
+    size_t pendingCount();
+
+    /**
+     * @brief Get work counters
+     */
+    const SchedulerStats &getStats() const { return stats; }
+
+    /**
+     * @brief Extract a path from a BFS distance field by descending distances
+     * @param map Map the field was built on
+     * @param moveDirections Neighbor order used to break ties
+     * @param distance Distance to the target per tile (-1 = unreachable)
+     * @param start Start tile
+     * @return Shortest path from start to the field's target, empty if unreachable
+     */
+    static std::vector<Position> followDistanceField(const BattleMap &map,
+                                                     const std::vector<std::pair<int, int>> &moveDirections,
+                                                     const std::vector<int> &distance, const Position &start);
+};
+
+#endif // PATHSCHEDULER_H
@@ -0,0 +1,628 @@
+/**
+ * @file PathServer.cpp
+ * @brief Resident pathfinding server over a Unix domain socket - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the PathServer class, including the
+ * socket handling, the worker pool and the binary request/response codec.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "PathServer.h"
+#include "../MapLoader/MapLoader.h"
+#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// ==================== Wire Encoding Helpers ====================
+
+namespace
+{
+    /**
+     * @brief Sequential little-endian reader over a request payload
+     */
+    class ByteReader
+    {
+    private:
+        const std::vector<uint8_t> &buffer;
+        size_t offset;
+        bool failed;
+
+    public:
+        explicit ByteReader(const std::vector<uint8_t> &data) : buffer(data), offset(0), failed(false) {}
+
+        bool ok() const { return !failed; }
+
+        uint32_t read(size_t bytes)
+        {
+            if (failed || offset + bytes > buffer.size())
+            {
+                failed = true;
+                return 0;
+            }
+            uint32_t value = 0;
+            for (size_t i = 0; i < bytes; ++i)
+            {
+                value |= static_cast<uint32_t>(buffer[offset + i]) << (8 * i);
+            }
+            offset += bytes;
+            return value;
+        }
+
+        uint8_t u8() { return static_cast<uint8_t>(read(1)); }
+        uint16_t u16() { return static_cast<uint16_t>(read(2)); }
+        uint32_t u32() { return read(4); }
+        Position position()
+        {
+            int x = u16();
+            int y = u16();
+            return Position(x, y);
+        }
+    };
+
+    /**
+     * @brief Little-endian writer building a response payload
+     */
+    class ByteWriter
+    {
+    private:
+        std::vector<uint8_t> &buffer;
+
+    public:
+        explicit ByteWriter(std::vector<uint8_t> &data) : buffer(data) {}
+
+        void write(uint32_t value, size_t bytes)
+        {
+            for (size_t i = 0; i < bytes; ++i)
+            {
+                buffer.push_back(static_cast<uint8_t>((value >> (8 * i)) & 0xFF));
+            }
+        }
+
+        void u8(uint8_t value) { write(value, 1); }
+        void u16(uint16_t value) { write(value, 2); }
+        void u32(uint32_t value) { write(value, 4); }
+        void path(const std::vector<Position> &positions)
+        {
+            u32(static_cast<uint32_t>(positions.size()));
+            buffer.reserve(buffer.size() + positions.size() * 4);
+            for (const auto &pos : positions)
+            {
+                u16(static_cast<uint16_t>(pos.x));
+                u16(static_cast<uint16_t>(pos.y));
+            }
+        }
+    };
+
+    bool readFully(int fd, uint8_t *data, size_t size)
+    {
+        size_t done = 0;
+        while (done < size)
+        {
+            ssize_t n = ::read(fd, data + done, size - done);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            done += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool writeFully(int fd, const uint8_t *data, size_t size)
+    {
+        size_t done = 0;
+        while (done < size)
+        {
+            ssize_t n = ::send(fd, data + done, size - done, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            done += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool isKnownAlgorithm(uint8_t algorithm)
+    {
+        return algorithm == PathProtocol::ALGO_ASTAR || algorithm == PathProtocol::ALGO_BFS ||
+               algorithm == PathProtocol::ALGO_DFS;
+    }
+
+    // A client that stalls this long in the middle of a frame is dropped, freeing its worker
+    const int CLIENT_READ_TIMEOUT_SECONDS = 5;
+}
+
+// ==================== Construction and Map Loading ====================
+
+PathServer::PathServer(const std::string &path, int workers)
+    : socketPath(path), workerCount(std::max(1, workers)), listenFd(-1), running(false)
+{
+    wakePipe[0] = -1;
+    wakePipe[1] = -1;
+}
+
+PathServer::~PathServer()
+{
+    stop();
+    for (auto &worker : workers)
+    {
+        if (worker.joinable())
+        {
+            queueReady.notify_all();
+            worker.join();
+        }
+    }
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        unlink(socketPath.c_str());
+    }
+    for (int fd : wakePipe)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+int PathServer::addMap(const std::string &filename)
+{
+    MapLoader mapLoader;
+    if (!mapLoader.loadFromFile(filename) || mapLoader.getLayers().empty())
+    {
+        std::cerr << "Error: Failed to load map " << filename << std::endl;
+        return -1;
+    }
+
+    const Layer &layer = mapLoader.getLayers()[0];
+    if (layer.width > 65535 || layer.height > 65535)
+    {
+        std::cerr << "Error: Map " << filename << " exceeds the protocol's 16-bit coordinates" << std::endl;
+        return -1;
+    }
+
+    // Load and validate once here; workers copy the engine, so they cannot fail or print later
+    LoadedMap map;
+    if (!map.engine.loadMapFromData(layer.data, layer.width, layer.height))
+    {
+        std::cerr << "Error: Map " << filename << " is not usable for pathfinding" << std::endl;
+        return -1;
+    }
+    map.name = filename;
+    map.data = layer.data;
+    map.width = layer.width;
+    map.height = layer.height;
+    maps.push_back(map);
+    return static_cast<int>(maps.size()) - 1;
+}
+
+int PathServer::getMapCount() const
+{
+    return static_cast<int>(maps.size());
+}
+
+// ==================== Socket and Worker Pool ====================
+
+bool PathServer::start()
+{
+    if (maps.empty())
+    {
+        std::cerr << "Error: No maps loaded; nothing to serve" << std::endl;
+        return false;
+    }
+
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Error: Socket path too long: " << socketPath << std::endl;
+        return false;
+    }
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        std::cerr << "Error: Could not create socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    unlink(socketPath.c_str()); // Remove a stale socket from a previous run
+    if (bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+        listen(listenFd, 128) < 0)
+    {
+        std::cerr << "Error: Could not listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    // Non-blocking so a full pipe never stalls a worker and the poll loop can drain it
+    if (pipe(wakePipe) < 0 || fcntl(wakePipe[0], F_SETFL, O_NONBLOCK) < 0 ||
+        fcntl(wakePipe[1], F_SETFL, O_NONBLOCK) < 0)
+    {
+        std::cerr << "Error: Could not create wake-up pipe: " << std::strerror(errno) << std::endl;
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    running = true;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back(&PathServer::workerLoop, this);
+    }
+
+    std::cout << "PathServer listening on " << socketPath << " with " << workerCount
+              << " workers and " << maps.size() << " map(s)" << std::endl;
+    return true;
+}
+
+void PathServer::run()
+{
+    std::vector<int> idleClients; // Open connections with no request in flight
+    std::vector<pollfd> pollSet;
+
+    while (running)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            idleClients.insert(idleClients.end(), returnedClients.begin(), returnedClients.end());
+            returnedClients.clear();
+        }
+
+        pollSet.clear();
+        pollfd entry;
+        entry.events = POLLIN;
+        entry.revents = 0;
+        entry.fd = listenFd;
+        pollSet.push_back(entry);
+        entry.fd = wakePipe[0];
+        pollSet.push_back(entry);
+        for (int fd : idleClients)
+        {
+            entry.fd = fd;
+            pollSet.push_back(entry);
+        }
+
+        // Short timeout so a stop() from a signal handler is noticed promptly
+        int ready = poll(pollSet.data(), pollSet.size(), 200);
+        if (ready <= 0)
+            continue;
+
+        if (pollSet[1].revents & POLLIN)
+        {
+            char drain[64];
+            while (read(wakePipe[0], drain, sizeof(drain)) > 0)
+            {
+            }
+        }
+
+        // Connections with a request (or a hang-up) go to the pool; the worker reads it or closes them
+        std::vector<int> readyClients;
+        idleClients.clear();
+        for (size_t i = 2; i < pollSet.size(); ++i)
+        {
+            if (pollSet[i].revents & (POLLIN | POLLHUP | POLLERR))
+                readyClients.push_back(pollSet[i].fd);
+            else
+                idleClients.push_back(pollSet[i].fd);
+        }
+        if (!readyClients.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                pendingClients.insert(pendingClients.end(), readyClients.begin(), readyClients.end());
+            }
+            queueReady.notify_all();
+        }
+
+        if (pollSet[0].revents & POLLIN)
+        {
+            int clientFd = accept(listenFd, nullptr, nullptr);
+            if (clientFd >= 0)
+            {
+                timeval timeout;
+                timeout.tv_sec = CLIENT_READ_TIMEOUT_SECONDS;
+                timeout.tv_usec = 0;
+                setsockopt(clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                idleClients.push_back(clientFd);
+            }
+        }
+    }
+
+    // Shutdown: drop idle and queued clients and unblock workers reading from active ones
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        idleClients.insert(idleClients.end(), pendingClients.begin(), pendingClients.end());
+        idleClients.insert(idleClients.end(), returnedClients.begin(), returnedClients.end());
+        pendingClients.clear();
+        returnedClients.clear();
+        for (int fd : idleClients)
+        {
+            close(fd);
+        }
+        for (int fd : activeClients)
+        {
+            shutdown(fd, SHUT_RDWR);
+        }
+    }
+    queueReady.notify_all();
+
+    for (auto &worker : workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    workers.clear();
+
+    std::cout << "PathServer stopped" << std::endl;
+}
+
+void PathServer::stop()
+{
+    running = false;
+}
+
+void PathServer::workerLoop()
+{
+    // Private engines: no search state is shared between workers
+    WorkerContext context;
+    for (const auto &map : maps)
+    {
+        context.pathfinders.push_back(std::unique_ptr<PathFinder>(new PathFinder(map.engine)));
+        context.multiPathfinders.push_back(std::unique_ptr<MultiUnitPathFinder>());
+    }
+
+    while (true)
+    {
+        int clientFd = -1;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]
+                            { return !pendingClients.empty() || !running; });
+            if (!running)
+                return;
+
+            clientFd = pendingClients.front();
+            pendingClients.pop_front();
+            activeClients.push_back(clientFd);
+        }
+
+        bool keepOpen = serveRequest(clientFd, context);
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            activeClients.erase(std::remove(activeClients.begin(), activeClients.end(), clientFd),
+                                activeClients.end());
+            // After shutdown began, run() no longer collects returned clients, so close them here
+            keepOpen = keepOpen && running;
+            if (keepOpen)
+                returnedClients.push_back(clientFd);
+        }
+
+        if (keepOpen)
+        {
+            // Wake the poll so the client's next request is seen without waiting for the timeout
+            char wake = 1;
+            ssize_t written = write(wakePipe[1], &wake, 1);
+            (void)written; // A full pipe already holds a pending wake-up
+        }
+        else
+        {
+            close(clientFd);
+        }
+    }
+}
+
+bool PathServer::serveRequest(int clientFd, WorkerContext &context)
+{
+    uint8_t header[4];
+    if (!readFully(clientFd, header, sizeof(header)))
+        return false; // Client closed the connection or stalled
+
+    uint32_t length = header[0] | (header[1] << 8) | (header[2] << 16) | (static_cast<uint32_t>(header[3]) << 24);
+    if (length == 0 || length > PathProtocol::MAX_FRAME_SIZE)
+    {
+        std::cerr << "Warning: Dropping client with invalid frame length " << length << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> request(length);
+    if (!readFully(clientFd, request.data(), length))
+        return false;
+
+    std::vector<uint8_t> response(4); // Length prefix, filled in below
+    handleRequest(request, response, context);
+
+    uint32_t responseLength = static_cast<uint32_t>(response.size() - 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        response[i] = static_cast<uint8_t>((responseLength >> (8 * i)) & 0xFF);
+    }
+
+    return writeFully(clientFd, response.data(), response.size());
+}
+
+// ==================== Request Handling ====================
+
+std::vector<Position> PathServer::runSearch(PathFinder &pathfinder, uint8_t algorithm,
+                                            const Position &start, const Position &target)
+{
+    switch (algorithm)
+    {
+    case PathProtocol::ALGO_BFS:
+        return pathfinder.findPathBFS(start, target);
+    case PathProtocol::ALGO_DFS:
+        return pathfinder.findPathDFS(start, target);
+    default: // ALGO_ASTAR; handleRequest() rejects unknown codes
+        return pathfinder.findPathAStar(start, target);
+    }
+}
+
+MultiUnitPathFinder &PathServer::getMultiPathfinder(WorkerContext &context, int mapIndex)
+{
+    std::unique_ptr<MultiUnitPathFinder> &slot = context.multiPathfinders[mapIndex];
+    if (!slot)
+    {
+        const LoadedMap &map = maps[mapIndex];
+        slot.reset(new MultiUnitPathFinder(map.engine)); // Copies the loaded map instead of reloading it
+        slot->setVerbose(false);
+    }
+    return *slot;
+}
+
+void PathServer::handleRequest(const std::vector<uint8_t> &request, std::vector<uint8_t> &response,
+                               WorkerContext &context)
+{
+    ByteReader in(request);
+    ByteWriter out(response);
+
+    uint8_t opcode = in.u8();
+
+    if (opcode == PathProtocol::OP_INFO)
+    {
+        out.u8(PathProtocol::STATUS_OK);
+        out.u16(static_cast<uint16_t>(maps.size()));
+        for (const auto &map : maps)
+        {
+            out.u16(static_cast<uint16_t>(map.width));
+            out.u16(static_cast<uint16_t>(map.height));
+        }
+        return;
+    }
+
+    int mapIndex = in.u16();
+    if (!in.ok())
+    {
+        out.u8(PathProtocol::STATUS_BAD_REQUEST);
+        return;
+    }
+    if (mapIndex >= static_cast<int>(maps.size()))
+    {
+        out.u8(PathProtocol::STATUS_NO_SUCH_MAP);
+        return;
+    }
+
+    const LoadedMap &map = maps[mapIndex];
+    PathFinder &pathfinder = *context.pathfinders[mapIndex];
+    const BattleMap &battleMap = pathfinder.getBattleMap();
+
+    if (opcode == PathProtocol::OP_PATH)
+    {
+        uint8_t algorithm = in.u8();
+        Position start = in.position();
+        Position target = in.position();
+        if (!in.ok() || !isKnownAlgorithm(algorithm))
+        {
+            out.u8(PathProtocol::STATUS_BAD_REQUEST);
+            return;
+        }
+        if (!battleMap.isValidPosition(start.x, start.y) || !battleMap.isValidPosition(target.x, target.y))
+        {
+            out.u8(PathProtocol::STATUS_INVALID_POS);
+            return;
+        }
+
+        std::vector<Position> path = runSearch(pathfinder, algorithm, start, target);
+        out.u8(PathProtocol::STATUS_OK);
+        out.u32(static_cast<uint32_t>(pathfinder.getLastSearchStats().nodesExpanded));
+        out.path(path);
+    }
+    else if (opcode == PathProtocol::OP_BATCH)
+    {
+        uint8_t algorithm = in.u8();
+        uint32_t count = in.u32();
+        if (!in.ok() || !isKnownAlgorithm(algorithm) || request.size() < 8 + static_cast<size_t>(count) * 8)
+        {
+            out.u8(PathProtocol::STATUS_BAD_REQUEST);
+            return;
+        }
+
+        std::vector<std::pair<Position, Position>> queries;
+        queries.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Position start = in.position();
+            Position target = in.position();
+            if (!battleMap.isValidPosition(start.x, start.y) || !battleMap.isValidPosition(target.x, target.y))
+            {
+                out.u8(PathProtocol::STATUS_INVALID_POS);
+                return;
+            }
+            queries.push_back(std::make_pair(start, target));
+        }
+
+        out.u8(PathProtocol::STATUS_OK);
+        out.u32(count);
+        for (const auto &query : queries)
+        {
+            out.path(runSearch(pathfinder, algorithm, query.first, query.second));
+        }
+    }
+    else if (opcode == PathProtocol::OP_MULTI)
+    {
+        uint8_t strategyCode = in.u8();
+        uint32_t count = in.u32();
+        if (!in.ok() || strategyCode > 3 || count == 0 || request.size() < 8 + static_cast<size_t>(count) * 8)
+        {
+            out.u8(PathProtocol::STATUS_BAD_REQUEST);
+            return;
+        }
+
+        MultiUnitPathFinder &multiPathfinder = getMultiPathfinder(context, mapIndex);
+        multiPathfinder.clearUnits();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Position start = in.position();
+            Position target = in.position();
+            if (start.x >= map.width || start.y >= map.height || target.x >= map.width || target.y >= map.height)
+            {
+                out.u8(PathProtocol::STATUS_INVALID_POS);
+                return;
+            }
+            multiPathfinder.addUnit(static_cast<int>(i), start, target);
+        }
+
+        static const ConflictResolutionStrategy strategies[] = {
+            ConflictResolutionStrategy::SEQUENTIAL, ConflictResolutionStrategy::PRIORITY_BASED,
+            ConflictResolutionStrategy::COOPERATIVE, ConflictResolutionStrategy::WAIT_AND_RETRY};
+        multiPathfinder.setConflictResolutionStrategy(strategies[strategyCode]);
+
+        PathfindingResult result = multiPathfinder.findPathsForAllUnits();
+
+        // Strategies may reorder units; answer in request order using unit ids
+        std::vector<const Unit *> byId(count, nullptr);
+        for (const auto &unit : result.units)
+        {
+            if (unit.id >= 0 && unit.id < static_cast<int>(count))
+                byId[unit.id] = &unit;
+        }
+
+        out.u8(PathProtocol::STATUS_OK);
+        out.u8(result.allPathsFound ? 1 : 0);
+        out.u32(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            bool found = byId[i] != nullptr && byId[i]->pathFound;
+            out.u8(found ? 1 : 0);
+            out.path(found ? byId[i]->path : std::vector<Position>());
+        }
+    }
+    else
+    {
+        out.u8(PathProtocol::STATUS_BAD_REQUEST);
+    }
+}
@@ -0,0 +1,210 @@
+/**
+ * @file PathServer.h
+ * @brief Resident pathfinding server over a Unix domain socket - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the PathServer class which loads battle maps once and
+ * answers single path, batch and multi-unit requests over a Unix domain
+ * socket using a compact length-prefixed binary protocol. Requests from any
+ * number of open connections are served concurrently by a fixed pool of
+ * worker threads.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef PATHSERVER_H
+#define PATHSERVER_H
+
+#include "../PathFinder/PathFinder.h"
+#include "../MultiUnitPathFinder/MultiUnitPathFinder.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @namespace PathProtocol
+ * @brief Wire constants of the PathServer binary protocol
+ *
+ * Every message is a frame: a little-endian uint32 payload length followed by
+ * the payload. Coordinates are little-endian uint16 values. See
+ * PathServer/README.md for the full message layouts.
+ */
+namespace PathProtocol
+{
+    const uint8_t OP_INFO = 0;  ///< Query loaded maps
+    const uint8_t OP_PATH = 1;  ///< Single path request
+    const uint8_t OP_BATCH = 2; ///< Many path requests on one map
+    const uint8_t OP_MULTI = 3; ///< Multi-unit solve on one map
+
+    const uint8_t STATUS_OK = 0;          ///< Request served
+    const uint8_t STATUS_BAD_REQUEST = 1; ///< Malformed payload or unknown opcode
+    const uint8_t STATUS_NO_SUCH_MAP = 2; ///< Map index out of range
+    const uint8_t STATUS_INVALID_POS = 3; ///< Start or target outside the map
+
+    const uint8_t ALGO_ASTAR = 0; ///< A* search
+    const uint8_t ALGO_BFS = 1;   ///< Breadth-first search
+    const uint8_t ALGO_DFS = 2;   ///< Depth-first search
+
+    const uint32_t MAX_FRAME_SIZE = 64u * 1024u * 1024u; ///< Frames larger than this are rejected
+}
+
+/**
+ * @brief Long-running pathfinding server over a Unix domain socket
+ *
+ * Maps are loaded once with addMap() before start(). Each worker thread owns
+ * private PathFinder and MultiUnitPathFinder instances per map, so requests
+ * never share mutable search state and need no locking beyond the connection
+ * queue.
+ *
+ * The accept loop in run() polls every idle connection. When one has a
+ * request waiting, it is queued for a worker, which reads and answers that
+ * single request and hands the connection back to be polled again. Workers
+ * therefore bound the number of requests served at once, not the number of
+ * open connections, and a connection is never polled while its request is
+ * in flight, so responses keep request order.
+ *
+ * @par Usage Example:
+ * @code
+ * PathServer server("/tmp/pathfinder.sock", 4);
+ * server.addMap("samples/single-unit/sample1_1.json");
+ * if (server.start()) {
+ *     server.run();  // Returns after stop() is called (e.g. from a signal handler)
+ * }
+ * @endcode
+ */
+class PathServer
+{
+private:
+    /**
+     * @brief Map loaded at startup, with an engine the workers copy
+     */
+    struct LoadedMap
+    {
+        std::string name;      ///< Source file name
+        std::vector<int> data; ///< Row-major tile data of the first layer
+        int width;             ///< Width in tiles
+        int height;            ///< Height in tiles
+        PathFinder engine;     ///< Engine loaded once; workers copy it instead of reloading
+    };
+
+    /**
+     * @brief Per-worker search engines, one per loaded map
+     */
+    struct WorkerContext
+    {
+        std::vector<std::unique_ptr<PathFinder>> pathfinders;               ///< Single-unit engines
+        std::vector<std::unique_ptr<MultiUnitPathFinder>> multiPathfinders; ///< Multi-unit engines (lazy)
+    };
+
+    std::string socketPath;           ///< Filesystem path of the listening socket
+    int workerCount;                  ///< Number of worker threads
+    int listenFd;                     ///< Listening socket descriptor
+    std::vector<LoadedMap> maps;      ///< Maps served, indexed by map id
+    std::vector<std::thread> workers; ///< Worker threads
+
+    std::deque<int> pendingClients;     ///< Client sockets with a request waiting for a worker
+    std::vector<int> activeClients;     ///< Client sockets whose request is being served
+    std::vector<int> returnedClients;   ///< Served client sockets to poll for their next request
+    std::mutex queueMutex;              ///< Guards pendingClients, activeClients and returnedClients
+    std::condition_variable queueReady; ///< Signals waiting requests or shutdown
+    std::atomic<bool> running;          ///< Cleared by stop()
+    int wakePipe[2];                    ///< Workers write to [1] to wake the poll in run()
+
+    /**
+     * @brief Worker thread main loop: take one request at a time from the queue and serve it
+     */
+    void workerLoop();
+
+    /**
+     * @brief Read one request frame from a client and write its response
+     * @param clientFd Connected client socket with data waiting
+     * @param context Worker-private search engines
+     * @return true if the connection stays open for further requests
+     */
+    bool serveRequest(int clientFd, WorkerContext &context);
+
+    /**
+     * @brief Decode one request payload and encode its response payload
+     * @param request Request payload (without length prefix)
+     * @param response Output response payload (without length prefix)
+     * @param context Worker-private search engines
+     */
+    void handleRequest(const std::vector<uint8_t> &request, std::vector<uint8_t> &response, WorkerContext &context);
+
+    /**
+     * @brief Get (creating on first use) the multi-unit engine for a map
+     * @param context Worker-private search engines
+     * @param mapIndex Map id
+     * @return Multi-unit pathfinder loaded with the map
+     */
+    MultiUnitPathFinder &getMultiPathfinder(WorkerContext &context, int mapIndex);
+
+    /**
+     * @brief Run one single-unit search with the requested algorithm
+     * @param pathfinder Engine to use
+     * @param algorithm One of PathProtocol::ALGO_*
+     * @param start Start position
+     * @param target Target position
+     * @return Path from start to target, empty if none found
+     */
+    static std::vector<Position> runSearch(PathFinder &pathfinder, uint8_t algorithm,
+                                           const Position &start, const Position &target);
+
+public:
+    /**
+     * @brief Constructor
+     * @param path Filesystem path for the Unix domain socket
+     * @param workers Number of worker threads (at least 1)
+     */
+    PathServer(const std::string &path, int workers);
+
+    /**
+     * @brief Destructor stops the server and removes the socket file
+     */
+    ~PathServer();
+
+    /**
+     * @brief Load a battle map JSON file to be served
+     * @param filename Map file path
+     * @return Map id used in requests, or -1 on failure
+     *
+     * Must be called before start().
+     */
+    int addMap(const std::string &filename);
+
+    /**
+     * @brief Get number of maps served
+     * @return Map count
+     */
+    int getMapCount() const;
+
+    /**
+     * @brief Bind the socket and spawn the worker pool
+     * @return true if the server is ready to accept clients
+     */
+    bool start();
+
+    /**
+     * @brief Accept clients and dispatch their requests until stop() is called
+     */
+    void run();
+
+    /**
+     * @brief Request shutdown
+     *
+     * Only clears an atomic flag, so it is safe to call from a signal
+     * handler. run() notices the flag within a fraction of a second, closes
+     * open client connections and joins the workers.
+     */
+    void stop();
+};
+
+#endif // PATHSERVER_H
@@ -0,0 +1,419 @@
+/**
+ * @file SharedMap.cpp
+ * @brief POSIX shared-memory interface between a game engine and the pathfinder - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of SharedMapSegment (segment
+ * creation, mapping, sequence-locked tile access and the two SPSC rings) and
+ * SharedMapWorker (request serving loop).
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "SharedMap.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <new>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "SharedMap requires lock-free 64-bit atomics to share counters between processes"
+#endif
+
+static_assert(sizeof(Position) == 2 * sizeof(int32_t), "Position must match the shared int32 pair layout");
+
+namespace
+{
+    const size_t AREA_ALIGNMENT = 64;
+
+    size_t alignUp(size_t value)
+    {
+        return (value + AREA_ALIGNMENT - 1) & ~(AREA_ALIGNMENT - 1);
+    }
+
+    size_t resultSlotSize(uint32_t pathCapacity)
+    {
+        return alignUp(sizeof(SharedPathResult) + static_cast<size_t>(pathCapacity) * sizeof(Position));
+    }
+}
+
+//==============================================================================
+// SharedMapSegment
+//==============================================================================
+
+SharedMapSegment::SharedMapSegment()
+    : base(nullptr), size(0), owner(false), header(nullptr), tilePlane(nullptr),
+      requests(nullptr), results(nullptr), resultStride(0)
+{
+}
+
+SharedMapSegment::~SharedMapSegment()
+{
+    bool unlink = owner;
+    std::string segmentName = name;
+    unmap();
+    if (unlink)
+        shm_unlink(segmentName.c_str());
+}
+
+size_t SharedMapSegment::segmentSize(int width, int height, uint32_t requestSlots, uint32_t resultSlots, uint32_t pathCapacity)
+{
+    size_t bytes = alignUp(sizeof(SharedMapHeader));
+    bytes += alignUp(static_cast<size_t>(width) * height * sizeof(int32_t));
+    bytes += alignUp(static_cast<size_t>(requestSlots) * sizeof(SharedPathRequest));
+    bytes += static_cast<size_t>(resultSlots) * resultSlotSize(pathCapacity);
+    return bytes;
+}
+
+void SharedMapSegment::layout()
+{
+    unsigned char *cursor = static_cast<unsigned char *>(base);
+    header = reinterpret_cast<SharedMapHeader *>(cursor);
+    cursor += alignUp(sizeof(SharedMapHeader));
+    tilePlane = reinterpret_cast<int32_t *>(cursor);
+    cursor += alignUp(static_cast<size_t>(header->width) * header->height * sizeof(int32_t));
+    requests = reinterpret_cast<SharedPathRequest *>(cursor);
+    cursor += alignUp(static_cast<size_t>(header->requestSlots) * sizeof(SharedPathRequest));
+    results = cursor;
+    resultStride = resultSlotSize(header->pathCapacity);
+}
+
+void SharedMapSegment::unmap()
+{
+    if (base != nullptr)
+        munmap(base, size);
+    base = nullptr;
+    size = 0;
+    owner = false;
+    header = nullptr;
+    tilePlane = nullptr;
+    requests = nullptr;
+    results = nullptr;
+    resultStride = 0;
+    name.clear();
+}
+
+bool SharedMapSegment::create(const std::string &segmentName, int width, int height,
+                              uint32_t requestSlots, uint32_t resultSlots, uint32_t pathCapacity)
+{
+    if (width <= 0 || height <= 0 || requestSlots == 0 || resultSlots == 0)
+    {
+        std::cerr << "Error: Invalid shared map geometry" << std::endl;
+        return false;
+    }
+
+    if (pathCapacity == 0)
+    {
+        uint64_t tiles = static_cast<uint64_t>(width) * height;
+        pathCapacity = static_cast<uint32_t>(std::min<uint64_t>(tiles, static_cast<uint64_t>(width) + height * 4u));
+    }
+
+    unmap();
+    size_t bytes = segmentSize(width, height, requestSlots, resultSlots, pathCapacity);
+
+    shm_unlink(segmentName.c_str()); // Replace stale segments from crashed runs
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        std::cerr << "Error: Cannot create shared memory " << segmentName << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0)
+    {
+        std::cerr << "Error: Cannot size shared memory " << segmentName << ": " << std::strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(segmentName.c_str());
+        return false;
+    }
+
+    void *mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "Error: Cannot map shared memory " << segmentName << ": " << std::strerror(errno) << std::endl;
+        shm_unlink(segmentName.c_str());
+        return false;
+    }
+
+    base = mapping;
+    size = bytes;
+    owner = true;
+    name = segmentName;
+
+    // The mapping is zero-filled; construct the header in place
+    header = new (base) SharedMapHeader();
+    header->width = width;
+    header->height = height;
+    header->requestSlots = requestSlots;
+    header->resultSlots = resultSlots;
+    header->pathCapacity = pathCapacity;
+    header->reserved = 0;
+    header->mapVersion.store(0, std::memory_order_relaxed);
+    header->requestHead.store(0, std::memory_order_relaxed);
+    header->requestTail.store(0, std::memory_order_relaxed);
+    header->resultHead.store(0, std::memory_order_relaxed);
+    header->resultTail.store(0, std::memory_order_relaxed);
+    layout();
+
+    std::fill(tilePlane, tilePlane + static_cast<size_t>(width) * height, 3);
+
+    // Publishing the magic last lets attach() reject half-initialized segments
+    header->layoutVersion = SharedMapProtocol::LAYOUT_VERSION;
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = SharedMapProtocol::MAGIC;
+    return true;
+}
+
+bool SharedMapSegment::attach(const std::string &segmentName)
+{
+    unmap();
+
+    int fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        std::cerr << "Error: Cannot open shared memory " << segmentName << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SharedMapHeader))
+    {
+        std::cerr << "Error: Shared memory " << segmentName << " is too small" << std::endl;
+        close(fd);
+        return false;
+    }
+
+    size_t bytes = static_cast<size_t>(info.st_size);
+    void *mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "Error: Cannot map shared memory " << segmentName << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    const SharedMapHeader *candidate = static_cast<const SharedMapHeader *>(mapping);
+    if (candidate->magic != SharedMapProtocol::MAGIC || candidate->layoutVersion != SharedMapProtocol::LAYOUT_VERSION ||
+        candidate->width <= 0 || candidate->height <= 0 || candidate->requestSlots == 0 || candidate->resultSlots == 0 ||
+        segmentSize(candidate->width, candidate->height, candidate->requestSlots, candidate->resultSlots, candidate->pathCapacity) > bytes)
+    {
+        std::cerr << "Error: Shared memory " << segmentName << " has an incompatible layout" << std::endl;
+        munmap(mapping, bytes);
+        return false;
+    }
+
+    base = mapping;
+    size = bytes;
+    owner = false;
+    name = segmentName;
+    layout();
+    return true;
+}
+
+void SharedMapSegment::beginTileUpdate()
+{
+    header->mapVersion.fetch_add(1, std::memory_order_acq_rel); // Odd: update in progress
+}
+
+void SharedMapSegment::endTileUpdate()
+{
+    header->mapVersion.fetch_add(1, std::memory_order_release); // Even: new version published
+}
+
+uint64_t SharedMapSegment::readTilesIfChanged(uint64_t knownVersion, std::vector<int> &out) const
+{
+    size_t tileCount = static_cast<size_t>(header->width) * header->height;
+
+    while (true)
+    {
+        uint64_t before = header->mapVersion.load(std::memory_order_acquire);
+        if (before == knownVersion)
+            return knownVersion;
+        if (before & 1u)
+        {
+            std::this_thread::yield(); // Engine is mid-update
+            continue;
+        }
+
+        out.assign(tilePlane, tilePlane + tileCount);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->mapVersion.load(std::memory_order_relaxed) == before)
+            return before;
+    }
+}
+
+bool SharedMapSegment::pushRequest(const SharedPathRequest &request)
+{
+    uint64_t head = header->requestHead.load(std::memory_order_relaxed);
+    if (head - header->requestTail.load(std::memory_order_acquire) >= header->requestSlots)
+        return false;
+
+    requests[head % header->requestSlots] = request;
+    header->requestHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+const SharedPathRequest *SharedMapSegment::peekRequest() const
+{
+    uint64_t tail = header->requestTail.load(std::memory_order_relaxed);
+    if (tail == header->requestHead.load(std::memory_order_acquire))
+        return nullptr;
+    return &requests[tail % header->requestSlots];
+}
+
+void SharedMapSegment::popRequest()
+{
+    header->requestTail.fetch_add(1, std::memory_order_release);
+}
+
+SharedPathResult *SharedMapSegment::reserveResult()
+{
+    uint64_t head = header->resultHead.load(std::memory_order_relaxed);
+    if (head - header->resultTail.load(std::memory_order_acquire) >= header->resultSlots)
+        return nullptr;
+    return reinterpret_cast<SharedPathResult *>(results + (head % header->resultSlots) * resultStride);
+}
+
+void SharedMapSegment::commitResult()
+{
+    header->resultHead.fetch_add(1, std::memory_order_release);
+}
+
+const SharedPathResult *SharedMapSegment::peekResult() const
+{
+    uint64_t tail = header->resultTail.load(std::memory_order_relaxed);
+    if (tail == header->resultHead.load(std::memory_order_acquire))
+        return nullptr;
+    return reinterpret_cast<const SharedPathResult *>(results + (tail % header->resultSlots) * resultStride);
+}
+
+void SharedMapSegment::popResult()
+{
+    header->resultTail.fetch_add(1, std::memory_order_release);
+}
+
+Position *SharedMapSegment::resultPath(const SharedPathResult *result) const
+{
+    unsigned char *slot = const_cast<unsigned char *>(reinterpret_cast<const unsigned char *>(result));
+    return reinterpret_cast<Position *>(slot + sizeof(SharedPathResult));
+}
+
+//==============================================================================
+// SharedMapWorker
+//==============================================================================
+
+SharedMapWorker::SharedMapWorker(SharedMapSegment &attachedSegment, const std::string &moveOrder)
+    : segment(attachedSegment), pathfinder(moveOrder), syncedVersion(UINT64_MAX)
+{
+}
+
+void SharedMapWorker::syncTerrain()
+{
+    uint64_t version = segment.readTilesIfChanged(syncedVersion, tileBuffer);
+    if (version == syncedVersion)
+        return;
+
+    const SharedMapHeader &header = segment.getHeader();
+    pathfinder.loadTerrainFromData(tileBuffer.data(), header.width, header.height);
+    syncedVersion = version;
+}
+
+size_t SharedMapWorker::poll()
+{
+    size_t answered = 0;
+    const SharedMapHeader &header = segment.getHeader();
+
+    while (true)
+    {
+        const SharedPathRequest *request = segment.peekRequest();
+        if (request == nullptr)
+            break;
+
+        SharedPathResult *result = segment.reserveResult();
+        if (result == nullptr)
+            break; // Engine has not drained results yet; keep the request queued
+
+        syncTerrain();
+
+        result->requestId = request->requestId;
+        result->length = 0;
+        result->nodesExpanded = 0;
+        result->mapVersion = syncedVersion;
+
+        const Position start = request->start;
+        const Position target = request->target;
+        const BattleMap &map = pathfinder.getBattleMap();
+
+        if (!map.isValidPosition(start.x, start.y) || !map.isValidPosition(target.x, target.y))
+        {
+            result->status = SharedMapProtocol::STATUS_INVALID_POS;
+        }
+        else if (request->algorithm < SharedMapProtocol::ALGO_ASTAR || request->algorithm > SharedMapProtocol::ALGO_DFS)
+        {
+            result->status = SharedMapProtocol::STATUS_BAD_REQUEST;
+        }
+        else
+        {
+            std::vector<Position> path;
+            if (map.isReachable(start.x, start.y) && map.isReachable(target.x, target.y))
+            {
+                if (request->algorithm == SharedMapProtocol::ALGO_BFS)
+                    path = pathfinder.findPathBFS(start, target);
+                else if (request->algorithm == SharedMapProtocol::ALGO_DFS)
+                    path = pathfinder.findPathDFS(start, target);
+                else
+                    path = pathfinder.findPathAStar(start, target);
+                result->nodesExpanded = pathfinder.getLastSearchStats().nodesExpanded;
+            }
+
+            result->length = static_cast<int32_t>(path.size());
+            if (path.empty())
+            {
+                result->status = SharedMapProtocol::STATUS_NO_PATH;
+            }
+            else
+            {
+                size_t written = std::min<size_t>(path.size(), header.pathCapacity);
+                std::copy(path.begin(), path.begin() + written, segment.resultPath(result));
+                result->status = written == path.size() ? SharedMapProtocol::STATUS_OK : SharedMapProtocol::STATUS_TRUNCATED;
+            }
+        }
+
+        segment.popRequest();
+        segment.commitResult();
+        answered++;
+    }
+
+    return answered;
+}
+
+void SharedMapWorker::run(const std::atomic<bool> &running)
+{
+    int idleRounds = 0;
+    while (running.load())
+    {
+        if (poll() > 0)
+        {
+            idleRounds = 0;
+        }
+        else if (++idleRounds < 1000)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+}
@@ -0,0 +1,315 @@
+/**
+ * @file SharedMap.h
+ * @brief POSIX shared-memory interface between a game engine and the pathfinder - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines a shared-memory segment holding a versioned tile plane,
+ * a request ring and a result ring, plus the SharedMapWorker which serves the
+ * requests. An engine process writes terrain and path requests directly into
+ * the segment and reads paths back from it, with no serialization and no
+ * system calls on the query path.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef SHAREDMAP_H
+#define SHAREDMAP_H
+
+#include "../PathFinder/PathFinder.h"
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @namespace SharedMapProtocol
+ * @brief Layout constants of the shared-memory segment
+ *
+ * See SharedMap/README.md for the byte layout an engine written in another
+ * language has to follow.
+ */
+namespace SharedMapProtocol
+{
+    const uint32_t MAGIC = 0x4D534650u; ///< "PFSM" in little-endian byte order
+    const uint32_t LAYOUT_VERSION = 1;  ///< Bumped whenever the layout changes
+
+    const int32_t STATUS_OK = 0;          ///< Path found and written in full
+    const int32_t STATUS_NO_PATH = 1;     ///< Endpoints valid but no path exists
+    const int32_t STATUS_INVALID_POS = 2; ///< Start or target outside the map
+    const int32_t STATUS_TRUNCATED = 3;   ///< Path longer than the slot capacity; length is the full length
+    const int32_t STATUS_BAD_REQUEST = 4; ///< Unknown algorithm code
+
+    const int32_t ALGO_ASTAR = 0; ///< A* search
+    const int32_t ALGO_BFS = 1;   ///< Breadth-first search
+    const int32_t ALGO_DFS = 2;   ///< Depth-first search
+}
+
+/**
+ * @brief Fixed header at offset 0 of the segment
+ *
+ * Counters live on separate cache lines so the engine and the worker do not
+ * false-share. mapVersion is a sequence lock: odd while the engine rewrites
+ * tiles, even (and larger than before) once the new terrain is complete.
+ */
+struct SharedMapHeader
+{
+    uint32_t magic;         ///< SharedMapProtocol::MAGIC
+    uint32_t layoutVersion; ///< SharedMapProtocol::LAYOUT_VERSION
+    int32_t width;          ///< Map width in tiles
+    int32_t height;         ///< Map height in tiles
+    uint32_t requestSlots;  ///< Capacity of the request ring
+    uint32_t resultSlots;   ///< Capacity of the result ring
+    uint32_t pathCapacity;  ///< Positions per result slot
+    uint32_t reserved;      ///< Padding, always 0
+
+    alignas(64) std::atomic<uint64_t> mapVersion;  ///< Tile plane sequence lock
+    alignas(64) std::atomic<uint64_t> requestHead; ///< Requests published by the engine
+    alignas(64) std::atomic<uint64_t> requestTail; ///< Requests consumed by the worker
+    alignas(64) std::atomic<uint64_t> resultHead;  ///< Results published by the worker
+    alignas(64) std::atomic<uint64_t> resultTail;  ///< Results consumed by the engine
+};
+
+/**
+ * @brief One path request in the request ring
+ */
+struct SharedPathRequest
+{
+    uint32_t requestId; ///< Caller-chosen id echoed in the result
+    int32_t algorithm;  ///< SharedMapProtocol::ALGO_* code
+    Position start;     ///< Start tile
+    Position target;    ///< Target tile
+};
+
+/**
+ * @brief Fixed part of one result slot; pathCapacity positions follow it
+ */
+struct SharedPathResult
+{
+    uint32_t requestId;    ///< Id of the answered request
+    int32_t status;        ///< SharedMapProtocol::STATUS_* code
+    int32_t length;        ///< Number of positions in the path (full length when truncated)
+    int32_t nodesExpanded; ///< Search effort
+    uint64_t mapVersion;   ///< Terrain version the path was computed on
+};
+
+/**
+ * @brief Mapping of a shared-memory segment with map, request and result areas
+ *
+ * The engine side creates the segment with create(); the pathfinder side
+ * attaches with attach(). Both rings are single-producer single-consumer:
+ * the engine is the only producer of requests and consumer of results, and
+ * one SharedMapWorker is the only consumer of requests and producer of results.
+ *
+ * @par Usage Example (engine side):
+ * @code
+ * SharedMapSegment segment;
+ * segment.create("/pf_world", 1024, 1024);
+ * segment.beginTileUpdate();
+ * std::copy(terrain, terrain + 1024 * 1024, segment.tiles());
+ * segment.endTileUpdate();
+ *
+ * SharedPathRequest request = {1, SharedMapProtocol::ALGO_ASTAR, Position(3, 4), Position(900, 17)};
+ * segment.pushRequest(request);
+ * const SharedPathResult *result;
+ * while ((result = segment.peekResult()) == nullptr) { }
+ * // ... read segment.resultPath(result) ...
+ * segment.popResult();
+ * @endcode
+ */
+class SharedMapSegment
+{
+private:
+    std::string name;            ///< Shared-memory object name (e.g. "/pf_world")
+    void *base;                  ///< Start of the mapping
+    size_t size;                 ///< Mapping size in bytes
+    bool owner;                  ///< True if this mapping created (and will unlink) the object
+    SharedMapHeader *header;     ///< Header at offset 0
+    int32_t *tilePlane;          ///< Row-major tiles
+    SharedPathRequest *requests; ///< Request ring
+    unsigned char *results;      ///< Result ring (variable slot size)
+    size_t resultStride;         ///< Bytes per result slot
+
+    /**
+     * @brief Compute area pointers from the header fields
+     */
+    void layout();
+
+    /**
+     * @brief Unmap and reset all members
+     */
+    void unmap();
+
+public:
+    /**
+     * @brief Construct an unmapped segment
+     */
+    SharedMapSegment();
+
+    /**
+     * @brief Unmap the segment and unlink it if this side created it
+     */
+    ~SharedMapSegment();
+
+    SharedMapSegment(const SharedMapSegment &) = delete;
+    SharedMapSegment &operator=(const SharedMapSegment &) = delete;
+
+    /**
+     * @brief Compute the segment size for the given geometry
+     * @return Size in bytes
+     */
+    static size_t segmentSize(int width, int height, uint32_t requestSlots, uint32_t resultSlots, uint32_t pathCapacity);
+
+    /**
+     * @brief Create (or replace) and map a segment, initializing all tiles to blocked
+     * @param segmentName POSIX shared-memory name, starting with '/'
+     * @param width Map width in tiles
+     * @param height Map height in tiles
+     * @param requestSlots Request ring capacity
+     * @param resultSlots Result ring capacity
+     * @param pathCapacity Positions stored per result (0 = width + height * 4, capped at width * height)
+     * @return true on success
+     */
+    bool create(const std::string &segmentName, int width, int height,
+                uint32_t requestSlots = 1024, uint32_t resultSlots = 1024, uint32_t pathCapacity = 0);
+
+    /**
+     * @brief Map an existing segment created by another process
+     * @param segmentName POSIX shared-memory name
+     * @return true if the segment exists and has a compatible layout
+     */
+    bool attach(const std::string &segmentName);
+
+    /**
+     * @brief Check whether a segment is mapped
+     */
+    bool isMapped() const { return base != nullptr; }
+
+    /**
+     * @brief Get the segment header
+     */
+    SharedMapHeader &getHeader() const { return *header; }
+
+    /**
+     * @brief Get the row-major tile plane (width * height entries)
+     */
+    int32_t *tiles() const { return tilePlane; }
+
+    /**
+     * @brief Mark the tile plane as being rewritten (engine side)
+     */
+    void beginTileUpdate();
+
+    /**
+     * @brief Publish the rewritten tile plane as a new version (engine side)
+     */
+    void endTileUpdate();
+
+    /**
+     * @brief Copy the tile plane if its version differs from knownVersion (worker side)
+     * @param knownVersion Version the caller currently holds
+     * @param out Receives width * height tiles when a newer version is available
+     * @return Version of the copied plane, or knownVersion if nothing changed
+     *
+     * Retries while the engine is mid-update so the copy is never torn.
+     */
+    uint64_t readTilesIfChanged(uint64_t knownVersion, std::vector<int> &out) const;
+
+    /**
+     * @brief Publish a request (engine side)
+     * @return false if the request ring is full
+     */
+    bool pushRequest(const SharedPathRequest &request);
+
+    /**
+     * @brief Get the oldest unconsumed request (worker side)
+     * @return Pointer into the ring, or nullptr if empty
+     */
+    const SharedPathRequest *peekRequest() const;
+
+    /**
+     * @brief Release the request returned by peekRequest() (worker side)
+     */
+    void popRequest();
+
+    /**
+     * @brief Get the next free result slot (worker side)
+     * @return Pointer into the ring, or nullptr if the result ring is full
+     */
+    SharedPathResult *reserveResult();
+
+    /**
+     * @brief Publish the slot returned by reserveResult() (worker side)
+     */
+    void commitResult();
+
+    /**
+     * @brief Get the oldest unconsumed result (engine side)
+     * @return Pointer into the ring, or nullptr if empty
+     */
+    const SharedPathResult *peekResult() const;
+
+    /**
+     * @brief Release the result returned by peekResult() (engine side)
+     */
+    void popResult();
+
+    /**
+     * @brief Get the position array that follows a result header
+     * @param result Result slot inside this segment
+     * @return Pointer to pathCapacity positions
+     */
+    Position *resultPath(const SharedPathResult *result) const;
+};
+
+/**
+ * @brief Serves the request ring of an attached segment with a PathFinder
+ *
+ * The worker keeps a private terrain copy and refreshes it only when the
+ * segment's map version changes, so steady-state queries involve no copies
+ * of the map and no serialization.
+ */
+class SharedMapWorker
+{
+private:
+    SharedMapSegment &segment;   ///< Attached segment
+    PathFinder pathfinder;       ///< Search engine over the synced terrain
+    uint64_t syncedVersion;      ///< Map version loaded into the engine
+    std::vector<int> tileBuffer; ///< Reused staging buffer for terrain refreshes
+
+    /**
+     * @brief Reload the terrain if the engine published a new version
+     */
+    void syncTerrain();
+
+public:
+    /**
+     * @brief Create a worker over an attached segment
+     * @param attachedSegment Segment mapped with attach() or create()
+     * @param moveOrder Neighbor expansion order
+     */
+    SharedMapWorker(SharedMapSegment &attachedSegment, const std::string &moveOrder = "rdlu");
+
+    /**
+     * @brief Serve all pending requests that fit into the result ring
+     * @return Number of requests answered
+     */
+    size_t poll();
+
+    /**
+     * @brief Serve requests until running becomes false
+     * @param running Cleared by another thread or a signal handler to stop
+     *
+     * Spins briefly when idle, then backs off to short sleeps.
+     */
+    void run(const std::atomic<bool> &running);
+
+    /**
+     * @brief Get the terrain version currently loaded
+     */
+    uint64_t getSyncedVersion() const { return syncedVersion; }
+};
+
+#endif // SHAREDMAP_H
@@ -0,0 +1,506 @@
+/**
+ * @file SubgoalGraph.cpp
+ * @brief Simple Subgoal Graph preprocessing and queries for grid maps - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the SubgoalGraph: subgoal
+ * placement, the quadrant sweeps that find directly h-reachable subgoals,
+ * graph search, segment expansion and the binary file format.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "SubgoalGraph.h"
+#include <algorithm>
+#include <fstream>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    const char FILE_MAGIC[4] = {'S', 'S', 'G', '1'};
+
+    template <typename T>
+    void writeValue(std::ofstream &file, const T &value)
+    {
+        file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream &file, T &value)
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+}
+
+SubgoalGraph::SubgoalGraph(const PathFinder &engine)
+    : pathfinder(engine), built(false), builtVersion(0), width(0), height(0), searchId(0)
+{
+}
+
+int SubgoalGraph::distance(int a, int b) const
+{
+    return std::abs(a % width - b % width) + std::abs(a / width - b / width);
+}
+
+uint64_t SubgoalGraph::terrainHash(const BattleMap &map)
+{
+    // FNV-1a over one reachability byte per tile
+    uint64_t hash = 1469598103934665603ULL;
+    for (int y = 0; y < map.height; ++y)
+    {
+        for (int x = 0; x < map.width; ++x)
+        {
+            hash ^= map.isReachable(x, y) ? 1u : 0u;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+void SubgoalGraph::sweep(const BattleMap &map, int origin, int stopTile, SweepScratch &scratch,
+                         std::vector<int> &found) const
+{
+    if (scratch.mark.size() != subgoalOfTile.size())
+    {
+        scratch.mark.assign(subgoalOfTile.size(), 0);
+        scratch.sweepId = 0;
+    }
+
+    int originX = origin % width;
+    int originY = origin / width;
+    static const int QUADRANTS[4][2] = {{1, 1}, {-1, 1}, {1, -1}, {-1, -1}};
+
+    // A tile is marked when a monotone route from the origin reaches it without
+    // passing a subgoal; subgoals (and stopTile) reached this way are recorded
+    for (const auto &quadrant : QUADRANTS)
+    {
+        int dx = quadrant[0];
+        int dy = quadrant[1];
+        if (++scratch.sweepId == 0)
+        {
+            std::fill(scratch.mark.begin(), scratch.mark.end(), 0);
+            scratch.sweepId = 1;
+        }
+        uint32_t id = scratch.sweepId;
+
+        int previousExtent = 0; // Last marked column of the previous row
+        for (int row = 0;; ++row)
+        {
+            int y = originY + row * dy;
+            if (y < 0 || y >= height)
+                break;
+
+            int extent = -1;
+            bool chain = false; // Marked tile directly behind in this row
+            for (int column = 0;; ++column)
+            {
+                int x = originX + column * dx;
+                if (x < 0 || x >= width || (column > previousExtent && !chain))
+                    break;
+
+                int index = y * width + x;
+                bool fromBehind = chain;
+                bool fromBelow = row > 0 && scratch.mark[index - dy * width] == id;
+                chain = false;
+                if (!map.isReachable(x, y))
+                    continue;
+
+                if (row == 0 && column == 0)
+                {
+                    scratch.mark[index] = id;
+                    chain = true;
+                    extent = 0;
+                    continue;
+                }
+                if (!fromBehind && !fromBelow)
+                    continue;
+
+                if (index == stopTile)
+                    found.push_back(-1);
+                else if (subgoalOfTile[index] >= 0)
+                    found.push_back(subgoalOfTile[index]);
+                else
+                {
+                    scratch.mark[index] = id;
+                    chain = true;
+                    extent = column;
+                }
+            }
+
+            if (extent < 0)
+                break;
+            previousExtent = extent;
+        }
+    }
+
+    // Tiles on the axes belong to two quadrants
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+}
+
+bool SubgoalGraph::build(TaskPool &pool)
+{
+    built = false;
+    if (!pathfinder.isMapLoaded())
+        return false;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    height = map.height;
+    subgoalTiles.clear();
+    subgoalOfTile.assign(static_cast<size_t>(width) * height, -1);
+
+    // Subgoals: reachable tiles diagonal to a blocked corner with both shared neighbors open
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (!map.isReachable(x, y))
+                continue;
+
+            bool corner = false;
+            for (int dy = -1; dy <= 1 && !corner; dy += 2)
+            {
+                for (int dx = -1; dx <= 1 && !corner; dx += 2)
+                {
+                    corner = map.isValidPosition(x + dx, y + dy) && !map.isReachable(x + dx, y + dy) &&
+                             map.isReachable(x + dx, y) && map.isReachable(x, y + dy);
+                }
+            }
+            if (corner)
+            {
+                subgoalOfTile[y * width + x] = static_cast<int>(subgoalTiles.size());
+                subgoalTiles.push_back(y * width + x);
+            }
+        }
+    }
+
+    // One sweep per subgoal, spread over the pool with per-worker marks
+    std::vector<std::vector<int>> neighbors(subgoalTiles.size());
+    std::vector<SweepScratch> scratch(pool.size());
+    parallelFor(pool, 0, subgoalTiles.size(), 64, [&](size_t begin, size_t end)
+                {
+                    SweepScratch &marks = scratch[TaskPool::workerIndex()];
+                    for (size_t i = begin; i < end; ++i)
+                        sweep(map, subgoalTiles[i], -1, marks, neighbors[i]);
+                });
+
+    // Drop u-v when some neighbor w lies on a shortest u-v route and links to v:
+    // u-w-v costs the same, and w's edges are strictly shorter, so every
+    // dropped edge is still replaced by kept ones
+    std::vector<std::vector<int>> kept(subgoalTiles.size());
+    parallelFor(pool, 0, subgoalTiles.size(), 64, [&](size_t begin, size_t end)
+                {
+                    for (size_t u = begin; u < end; ++u)
+                    {
+                        int tileU = subgoalTiles[u];
+                        for (int v : neighbors[u])
+                        {
+                            if (v == static_cast<int>(u))
+                                continue;
+                            int tileV = subgoalTiles[v];
+                            int direct = distance(tileU, tileV);
+                            bool redundant = false;
+                            for (int w : neighbors[u])
+                            {
+                                int tileW = subgoalTiles[w];
+                                if (w != v && w != static_cast<int>(u) &&
+                                    distance(tileU, tileW) + distance(tileW, tileV) == direct &&
+                                    std::binary_search(neighbors[w].begin(), neighbors[w].end(), v))
+                                {
+                                    redundant = true;
+                                    break;
+                                }
+                            }
+                            if (!redundant)
+                                kept[u].push_back(v);
+                        }
+                    }
+                });
+
+    edgeStart.assign(1, 0);
+    edges.clear();
+    for (const std::vector<int> &links : kept)
+    {
+        edges.insert(edges.end(), links.begin(), links.end());
+        edgeStart.push_back(static_cast<uint32_t>(edges.size()));
+    }
+
+    builtVersion = pathfinder.getMapVersion();
+    built = true;
+    return true;
+}
+
+bool SubgoalGraph::isBuilt() const
+{
+    return built && builtVersion == pathfinder.getMapVersion();
+}
+
+void SubgoalGraph::appendSegment(const BattleMap &map, int from, int to, std::vector<Position> &path) const
+{
+    int fromX = from % width, fromY = from / width;
+    int toX = to % width, toY = to / width;
+    int dx = toX >= fromX ? 1 : -1;
+    int dy = toY >= fromY ? 1 : -1;
+    int columns = std::abs(toX - fromX) + 1;
+    int rows = std::abs(toY - fromY) + 1;
+
+    // Monotone reachability inside the bounding box, then walk back from the end
+    std::vector<uint8_t> reach(static_cast<size_t>(columns) * rows, 0);
+    for (int row = 0; row < rows; ++row)
+    {
+        for (int column = 0; column < columns; ++column)
+        {
+            if (!map.isReachable(fromX + column * dx, fromY + row * dy))
+                continue;
+            reach[row * columns + column] = (row == 0 && column == 0) ||
+                                            (column > 0 && reach[row * columns + column - 1]) ||
+                                            (row > 0 && reach[(row - 1) * columns + column]);
+        }
+    }
+
+    std::vector<Position> segment;
+    int column = columns - 1;
+    int row = rows - 1;
+    while (column > 0 || row > 0)
+    {
+        segment.push_back(Position(fromX + column * dx, fromY + row * dy));
+        if (column > 0 && reach[row * columns + column - 1])
+            column--;
+        else
+            row--;
+    }
+    path.insert(path.end(), segment.rbegin(), segment.rend());
+}
+
+std::vector<Position> SubgoalGraph::findPath(const Position &start, const Position &target)
+{
+    lastSearchStats = SearchStats();
+    if (!isBuilt() && !build())
+        return {};
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    int startTile = start.y * width + start.x;
+    int targetTile = target.y * width + target.x;
+    if (startTile == targetTile)
+    {
+        lastSearchStats.pathCost = 0;
+        return {start};
+    }
+
+    // Nodes: subgoals, then the start and the target
+    int nodeCount = static_cast<int>(subgoalTiles.size()) + 2;
+    int startNode = nodeCount - 2;
+    int targetNode = nodeCount - 1;
+    if (searchStamp.size() != static_cast<size_t>(nodeCount))
+    {
+        gCost.assign(nodeCount, 0);
+        parent.assign(nodeCount, -1);
+        searchStamp.assign(nodeCount, 0);
+        closed.assign(nodeCount, 0);
+        targetLink.assign(nodeCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        std::fill(searchStamp.begin(), searchStamp.end(), 0);
+        std::fill(targetLink.begin(), targetLink.end(), 0);
+        searchId = 1;
+    }
+
+    std::vector<int> startLinks;
+    std::vector<int> targetLinks;
+    sweep(map, startTile, targetTile, queryScratch, startLinks);
+    sweep(map, targetTile, -1, queryScratch, targetLinks);
+    for (int node : targetLinks)
+    {
+        targetLink[node] = searchId;
+    }
+
+    auto tileOf = [&](int node)
+    {
+        if (node == startNode)
+            return startTile;
+        if (node == targetNode)
+            return targetTile;
+        return subgoalTiles[node];
+    };
+
+    std::vector<OpenEntry> open;
+    auto relax = [&](int node, int from, int cost)
+    {
+        if (searchStamp[node] != searchId)
+        {
+            searchStamp[node] = searchId;
+            closed[node] = 0;
+        }
+        else if (closed[node] || gCost[node] <= cost)
+        {
+            return;
+        }
+        gCost[node] = cost;
+        parent[node] = from;
+        OpenEntry entry = {cost + distance(tileOf(node), targetTile), cost, node};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        lastSearchStats.nodesGenerated++;
+    };
+
+    relax(startNode, -1, 0);
+    bool found = false;
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int node = entry.node;
+        if (closed[node] || entry.g != gCost[node])
+            continue;
+
+        closed[node] = 1;
+        lastSearchStats.nodesExpanded++;
+        int tile = tileOf(node);
+        if (node == targetNode || tile == targetTile)
+        {
+            found = true;
+            if (node != targetNode)
+            {
+                parent[targetNode] = node;
+                gCost[targetNode] = gCost[node];
+            }
+            break;
+        }
+
+        if (node == startNode)
+        {
+            for (int link : startLinks)
+                relax(link < 0 ? targetNode : link, node, distance(tile, link < 0 ? targetTile : subgoalTiles[link]));
+            continue;
+        }
+
+        for (uint32_t e = edgeStart[node]; e < edgeStart[node + 1]; ++e)
+        {
+            relax(edges[e], node, gCost[node] + distance(tile, subgoalTiles[edges[e]]));
+        }
+        if (targetLink[node] == searchId)
+            relax(targetNode, node, gCost[node] + distance(tile, targetTile));
+    }
+
+    if (!found)
+        return {};
+
+    // Waypoints from target back to start, then expand each h-reachable segment
+    std::vector<int> waypoints;
+    for (int node = targetNode; node >= 0; node = parent[node])
+    {
+        int tile = tileOf(node);
+        if (waypoints.empty() || waypoints.back() != tile)
+            waypoints.push_back(tile);
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+
+    std::vector<Position> path;
+    path.push_back(start);
+    for (size_t i = 1; i < waypoints.size(); ++i)
+    {
+        appendSegment(map, waypoints[i - 1], waypoints[i], path);
+    }
+    lastSearchStats.pathCost = static_cast<int>(path.size()) - 1;
+    return path;
+}
+
+bool SubgoalGraph::save(const std::string &filename) const
+{
+    if (!isBuilt())
+        return false;
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    writeValue(file, static_cast<int32_t>(width));
+    writeValue(file, static_cast<int32_t>(height));
+    writeValue(file, terrainHash(pathfinder.getBattleMap()));
+    writeValue(file, static_cast<uint32_t>(subgoalTiles.size()));
+    writeValue(file, static_cast<uint32_t>(edges.size()));
+    file.write(reinterpret_cast<const char *>(subgoalTiles.data()), subgoalTiles.size() * sizeof(int32_t));
+    file.write(reinterpret_cast<const char *>(edgeStart.data()), edgeStart.size() * sizeof(uint32_t));
+    file.write(reinterpret_cast<const char *>(edges.data()), edges.size() * sizeof(int32_t));
+    return static_cast<bool>(file);
+}
+
+bool SubgoalGraph::load(const std::string &filename)
+{
+    if (!pathfinder.isMapLoaded())
+        return false;
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    char magic[4];
+    int32_t fileWidth, fileHeight;
+    uint64_t hash;
+    uint32_t subgoals, edgeTotal;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, fileWidth) || !readValue(file, fileHeight) || !readValue(file, hash) ||
+        !readValue(file, subgoals) || !readValue(file, edgeTotal))
+        return false;
+    if (fileWidth != map.width || fileHeight != map.height || hash != terrainHash(map))
+        return false; // Saved for different terrain
+
+    // Bound the counts before allocating: at most one subgoal per tile and one edge per subgoal pair
+    size_t tileCount = static_cast<size_t>(map.width) * map.height;
+    if (subgoals > tileCount || edgeTotal > static_cast<uint64_t>(subgoals) * subgoals)
+        return false;
+
+    std::vector<int> tiles(subgoals);
+    std::vector<uint32_t> offsets(static_cast<size_t>(subgoals) + 1);
+    std::vector<int> links(edgeTotal);
+    if (!file.read(reinterpret_cast<char *>(tiles.data()), tiles.size() * sizeof(int32_t)) ||
+        !file.read(reinterpret_cast<char *>(offsets.data()), offsets.size() * sizeof(uint32_t)) ||
+        !file.read(reinterpret_cast<char *>(links.data()), links.size() * sizeof(int32_t)))
+        return false;
+
+    // Check the body before swapping anything in, so a corrupt file leaves the graph as it was
+    std::vector<int> tileOwner(tileCount, -1);
+    for (size_t i = 0; i < tiles.size(); ++i)
+    {
+        int tile = tiles[i];
+        if (tile < 0 || static_cast<size_t>(tile) >= tileCount || tileOwner[tile] >= 0 ||
+            !map.isReachable(tile % map.width, tile / map.width))
+            return false;
+        tileOwner[tile] = static_cast<int>(i);
+    }
+    if (offsets.front() != 0 || offsets.back() != edgeTotal)
+        return false;
+    for (size_t i = 1; i < offsets.size(); ++i)
+    {
+        if (offsets[i] < offsets[i - 1])
+            return false;
+    }
+    for (int link : links)
+    {
+        if (link < 0 || static_cast<uint32_t>(link) >= subgoals)
+            return false;
+    }
+
+    width = map.width;
+    height = map.height;
+    subgoalTiles.swap(tiles);
+    edgeStart.swap(offsets);
+    edges.swap(links);
+    subgoalOfTile.swap(tileOwner);
+    builtVersion = pathfinder.getMapVersion();
+    built = true;
+    return true;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file SubgoalGraph.h
+ * @brief Simple Subgoal Graph preprocessing and queries for grid maps - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the SubgoalGraph, which places subgoals at the convex
+ * corners of blocked tiles, connects the pairs that are directly reachable
+ * by a shortest (Manhattan) route, and answers queries by searching this
+ * small graph instead of the tile grid. The graph can be saved to disk and
+ * loaded again for the same terrain.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef SUBGOALGRAPH_H
+#define SUBGOALGRAPH_H
+
+#include "../PathFinder/PathFinder.h"
+#include "../TaskPool/TaskPool.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Simple Subgoal Graph (Uras, Koenig and Hernandez 2013) for 4-connected grids
+ *
+ * A subgoal is a reachable tile diagonal to the corner of a blocked tile
+ * whose two shared neighbors are reachable. Two tiles are h-reachable when a
+ * path of length equal to their Manhattan distance connects them; such a path
+ * is monotone in x and y. Subgoals are connected when they are h-reachable
+ * without passing through another subgoal, with the Manhattan distance as
+ * edge cost. Every shortest path on the grid can be cut into such segments,
+ * so searching the graph gives shortest paths.
+ *
+ * A query connects the start and the target to their directly h-reachable
+ * subgoals, runs A* on the graph and expands each edge into tiles.
+ *
+ * @par Usage Example:
+ * @code
+ * SubgoalGraph graph(pathfinder);
+ * if (!graph.load("map.ssg"))
+ * {
+ *     graph.build();
+ *     graph.save("map.ssg");
+ * }
+ * std::vector<Position> path = graph.findPath(start, target);
+ * @endcode
+ *
+ * @note The graph belongs to the terrain it was built for. findPath() rebuilds
+ *       it when the PathFinder's map version changes, and load() rejects files
+ *       saved for different terrain. Queries on one instance are not thread safe.
+ */
+class SubgoalGraph
+{
+private:
+    /**
+     * @brief Reusable marks for one h-reachability sweep
+     */
+    struct SweepScratch
+    {
+        std::vector<uint32_t> mark; ///< Sweep id that marked a tile as passable
+        uint32_t sweepId;           ///< Current sweep id
+
+        /**
+         * @brief Default constructor
+         */
+        SweepScratch() : sweepId(0) {}
+    };
+
+    /**
+     * @brief Open list entry for the graph search; stale entries are skipped
+     */
+    struct OpenEntry
+    {
+        int f;    ///< g + h
+        int g;    ///< Cost from the start, higher wins ties
+        int node; ///< Graph node
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing the map
+    bool built;                   ///< true once build() or load() succeeded
+    uint64_t builtVersion;        ///< Map version the graph was built for
+    int width;                    ///< Map width the graph was built for
+    int height;                   ///< Map height the graph was built for
+
+    std::vector<int> subgoalTiles;   ///< Tile index per subgoal
+    std::vector<int> subgoalOfTile;  ///< Subgoal per tile (-1 = none)
+    std::vector<uint32_t> edgeStart; ///< CSR offsets into edges, one per subgoal plus one
+    std::vector<int> edges;          ///< Neighbor subgoals
+
+    SweepScratch queryScratch;         ///< Sweep marks used by queries
+    std::vector<int> gCost;            ///< Graph search cost per node
+    std::vector<int> parent;           ///< Graph search predecessor per node
+    std::vector<uint32_t> searchStamp; ///< Search id that last touched each node
+    std::vector<uint8_t> closed;       ///< Expanded flag, valid where the stamp matches
+    std::vector<uint32_t> targetLink;  ///< Search id for subgoals directly h-reachable from the target
+    uint32_t searchId;                 ///< Current graph search id
+    SearchStats lastSearchStats;       ///< Effort of the last query
+
+    /**
+     * @brief Collect the subgoals directly h-reachable from a tile
+     * @param map Map to sweep
+     * @param origin Tile index to sweep from
+     * @param stopTile Extra tile treated like a subgoal (-1 = none)
+     * @param scratch Sweep marks
+     * @param found Receives subgoal ids, and -1 if stopTile was reached
+     */
+    void sweep(const BattleMap &map, int origin, int stopTile, SweepScratch &scratch,
+               std::vector<int> &found) const;
+
+    /**
+     * @brief Append a monotone shortest route between two h-reachable tiles
+     * @param map Map the route lies on
+     * @param from First tile index (already in path)
+     * @param to Last tile index
+     * @param path Receives the tiles after from, up to and including to
+     */
+    void appendSegment(const BattleMap &map, int from, int to, std::vector<Position> &path) const;
+
+    /**
+     * @brief Fingerprint of the map's reachability, stored in saved graphs
+     */
+    static uint64_t terrainHash(const BattleMap &map);
+
+    /**
+     * @brief Manhattan distance between two tile indices
+     */
+    int distance(int a, int b) const;
+
+public:
+    /**
+     * @brief Create an empty graph over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit SubgoalGraph(const PathFinder &engine);
+
+    /**
+     * @brief Place subgoals and connect them for the current map
+     * @param pool Pool the per-subgoal sweeps run on
+     * @return false if no map is loaded
+     */
+    bool build(TaskPool &pool = TaskPool::shared());
+
+    /**
+     * @brief Check whether the graph matches the current map
+     */
+    bool isBuilt() const;
+
+    /**
+     * @brief Find a shortest path by searching the subgoal graph
+     * @param start Start position
+     * @param target Target position
+     * @return Path from start to target, empty if none exists
+     *
+     * Builds the graph first if it does not match the current map.
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target);
+
+    /**
+     * @brief Write the graph to a binary file
+     * @param filename Output file path
+     * @return false if the graph is not built or the file cannot be written
+     */
+    bool save(const std::string &filename) const;
+
+    /**
+     * @brief Read a graph written by save()
+     * @param filename Input file path
+     * @return false if the file is unreadable, truncated or corrupt, or was saved for different terrain
+     */
+    bool load(const std::string &filename);
+
+    /**
+     * @brief Get the number of subgoals
+     */
+    size_t subgoalCount() const { return subgoalTiles.size(); }
+
+    /**
+     * @brief Get the number of undirected edges
+     */
+    size_t edgeCount() const { return edges.size() / 2; }
+
+    /**
+     * @brief Get search effort of the last findPath() call (in graph nodes)
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+};
+
+#endif // SUBGOALGRAPH_H
@@ -0,0 +1,232 @@
+/**
+ * @file SymmetryReduction.cpp
+ * @brief Rectangular Symmetry Reduction for searches on open maps - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the SymmetryReduction engine:
+ * the greedy rectangle decomposition, perimeter-only A* with macro steps
+ * across rectangles, and the expansion of straight edges into tiles.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "SymmetryReduction.h"
+#include <algorithm>
+#include <cstdlib>
+
+SymmetryReduction::SymmetryReduction(const PathFinder &engine)
+    : pathfinder(engine), built(false), builtVersion(0), width(0), searchId(0)
+{
+}
+
+bool SymmetryReduction::build()
+{
+    built = false;
+    if (!pathfinder.isMapLoaded())
+        return false;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    int height = map.height;
+    rectangles.clear();
+    rectangleOf.assign(static_cast<size_t>(width) * height, -1);
+
+    auto isFree = [&](int x, int y)
+    {
+        return map.isReachable(x, y) && rectangleOf[y * width + x] < 0;
+    };
+    auto columnFree = [&](int x, int top, int bottom)
+    {
+        for (int y = top; y <= bottom; ++y)
+            if (!isFree(x, y))
+                return false;
+        return true;
+    };
+    auto rowFree = [&](int y, int left, int right)
+    {
+        for (int x = left; x <= right; ++x)
+            if (!isFree(x, y))
+                return false;
+        return true;
+    };
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (!isFree(x, y))
+                continue;
+
+            // Largest square first, then stretch right and down
+            EmptyRectangle rectangle = {x, y, x, y};
+            while (columnFree(rectangle.right + 1, rectangle.top, rectangle.bottom + 1) &&
+                   rowFree(rectangle.bottom + 1, rectangle.left, rectangle.right))
+            {
+                rectangle.right++;
+                rectangle.bottom++;
+            }
+            while (columnFree(rectangle.right + 1, rectangle.top, rectangle.bottom))
+                rectangle.right++;
+            while (rowFree(rectangle.bottom + 1, rectangle.left, rectangle.right))
+                rectangle.bottom++;
+
+            int id = static_cast<int>(rectangles.size());
+            rectangles.push_back(rectangle);
+            for (int ry = rectangle.top; ry <= rectangle.bottom; ++ry)
+                for (int rx = rectangle.left; rx <= rectangle.right; ++rx)
+                    rectangleOf[ry * width + rx] = id;
+        }
+    }
+
+    builtVersion = pathfinder.getMapVersion();
+    built = true;
+    return true;
+}
+
+std::vector<Position> SymmetryReduction::findPath(const Position &start, const Position &target)
+{
+    lastSearchStats = SearchStats();
+    if ((!built || builtVersion != pathfinder.getMapVersion()) && !build())
+        return {};
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    int startIndex = start.y * width + start.x;
+    int targetIndex = target.y * width + target.x;
+    size_t tileCount = rectangleOf.size();
+    if (stamp.size() != tileCount)
+    {
+        gCost.assign(tileCount, 0);
+        parent.assign(tileCount, -1);
+        stamp.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+
+    auto distance = [&](int a, int b)
+    {
+        return std::abs(a % width - b % width) + std::abs(a / width - b / width);
+    };
+    auto push = [&](int index, int from, int cost)
+    {
+        if (stamp[index] != searchId)
+        {
+            stamp[index] = searchId;
+            closed[index] = 0;
+        }
+        else if (closed[index] || gCost[index] <= cost)
+        {
+            return;
+        }
+        gCost[index] = cost;
+        parent[index] = from;
+        OpenEntry entry = {cost + distance(index, targetIndex), cost, index};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        lastSearchStats.nodesGenerated++;
+    };
+
+    open.clear();
+    bool found = false;
+    if (rectangleOf[startIndex] == rectangleOf[targetIndex])
+    {
+        // Any monotone route inside one rectangle is free: one straight leg per axis
+        int corner = start.y * width + target.x;
+        stamp[startIndex] = searchId;
+        parent[startIndex] = -1;
+        stamp[corner] = searchId;
+        parent[corner] = corner == startIndex ? -1 : startIndex;
+        if (targetIndex != corner)
+        {
+            stamp[targetIndex] = searchId;
+            parent[targetIndex] = corner;
+        }
+        found = true;
+    }
+    else
+    {
+        push(startIndex, -1, 0);
+    }
+
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+    while (!found && !open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.index;
+        if (closed[current] || entry.g != gCost[current])
+            continue;
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        if (current == targetIndex)
+        {
+            found = true;
+            break;
+        }
+
+        int x = current % width;
+        int y = current / width;
+        int id = rectangleOf[current];
+        const EmptyRectangle &rectangle = rectangles[id];
+        bool targetInside = rectangleOf[targetIndex] == id;
+
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+
+            int neighbor = ny * width + nx;
+            if (rectangleOf[neighbor] != id || rectangle.onPerimeter(nx, ny))
+            {
+                push(neighbor, current, entry.g + 1);
+                continue;
+            }
+
+            // Interior: one macro step straight across to the opposite border
+            int borderX = direction.first > 0 ? rectangle.right : direction.first < 0 ? rectangle.left : x;
+            int borderY = direction.second > 0 ? rectangle.bottom : direction.second < 0 ? rectangle.top : y;
+            int border = borderY * width + borderX;
+            if (targetInside && (direction.first != 0 ? target.y == y && (target.x - x) * direction.first > 0
+                                                      : target.x == x && (target.y - y) * direction.second > 0))
+            {
+                push(targetIndex, current, entry.g + distance(current, targetIndex));
+            }
+            push(border, current, entry.g + distance(current, border));
+        }
+    }
+
+    if (!found)
+        return {};
+
+    // Parent links are straight lines; walk each one tile by tile
+    std::vector<Position> path;
+    for (int index = targetIndex; index >= 0; index = parent[index])
+    {
+        int from = parent[index];
+        int x = index % width;
+        int y = index / width;
+        path.push_back(Position(x, y));
+        if (from < 0)
+            break;
+        int stepX = from % width > x ? 1 : from % width < x ? -1 : 0;
+        int stepY = from / width > y ? 1 : from / width < y ? -1 : 0;
+        for (int k = 1; k < distance(index, from); ++k)
+            path.push_back(Position(x + k * stepX, y + k * stepY));
+    }
+    std::reverse(path.begin(), path.end());
+    lastSearchStats.pathCost = static_cast<int>(path.size()) - 1;
+    return path;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file SymmetryReduction.h
+ * @brief Rectangular Symmetry Reduction for searches on open maps - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the SymmetryReduction engine. It decomposes the
+ * reachable tiles into empty rectangles once per map and then runs A* that
+ * only expands rectangle perimeters, crossing each rectangle with a single
+ * macro step instead of exploring its many equivalent interior paths.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef SYMMETRYREDUCTION_H
+#define SYMMETRYREDUCTION_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Empty rectangle of reachable tiles, bounds inclusive
+ */
+struct EmptyRectangle
+{
+    int left;   ///< Leftmost column
+    int top;    ///< Topmost row
+    int right;  ///< Rightmost column
+    int bottom; ///< Bottom row
+
+    /**
+     * @brief Check whether a tile is on the rectangle's border
+     */
+    bool onPerimeter(int x, int y) const { return x == left || x == right || y == top || y == bottom; }
+};
+
+/**
+ * @brief A* with Rectangular Symmetry Reduction (Harabor, Botea and Kilby 2011)
+ *
+ * Inside an empty rectangle every monotone route between two border tiles is
+ * equally short, so only the border is searched. A border tile's successors
+ * are its neighbors on the same border, its neighbors in adjacent rectangles,
+ * and a macro step straight across the rectangle to the opposite border.
+ * A start or target inside a rectangle is connected to the four border tiles
+ * straight above, below, left and right of it. Paths stay optimal.
+ *
+ * @par Usage Example:
+ * @code
+ * SymmetryReduction rsr(pathfinder);
+ * std::vector<Position> path = rsr.findPath(start, target);
+ * int expanded = rsr.getLastSearchStats().nodesExpanded;
+ * @endcode
+ *
+ * @note The decomposition is rebuilt automatically when the PathFinder's map
+ *       version changes. Queries on one instance are not thread safe.
+ */
+class SymmetryReduction
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int g;     ///< Cost from the start, higher wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing map and move order
+    bool built;                   ///< true once the decomposition exists
+    uint64_t builtVersion;        ///< Map version the decomposition belongs to
+    int width;                    ///< Map width of the decomposition
+
+    std::vector<EmptyRectangle> rectangles; ///< Decomposition of the reachable tiles
+    std::vector<int> rectangleOf;           ///< Rectangle per tile (-1 = blocked)
+
+    std::vector<int> gCost;      ///< Cost per tile, valid where stamp matches
+    std::vector<int> parent;     ///< Predecessor tile per tile (edges are straight lines)
+    std::vector<uint32_t> stamp; ///< Search id that last touched each tile
+    std::vector<uint8_t> closed; ///< Expanded flag, valid where stamp matches
+    std::vector<OpenEntry> open; ///< Binary heap of open entries
+    uint32_t searchId;           ///< Current search id
+    SearchStats lastSearchStats; ///< Effort of the last search
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map and move order (must outlive this object)
+     */
+    explicit SymmetryReduction(const PathFinder &engine);
+
+    /**
+     * @brief Decompose the current map into empty rectangles
+     * @return false if no map is loaded
+     *
+     * Each rectangle grows as a square from its top-left tile and is then
+     * extended along the longer free side.
+     */
+    bool build();
+
+    /**
+     * @brief Find a shortest path, expanding rectangle perimeters only
+     * @param start Start position
+     * @param target Target position
+     * @return Path from start to target, empty if none exists
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target);
+
+    /**
+     * @brief Get the rectangles of the current decomposition
+     */
+    const std::vector<EmptyRectangle> &getRectangles() const { return rectangles; }
+
+    /**
+     * @brief Get search effort of the last findPath() call
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+};
+
+#endif // SYMMETRYREDUCTION_H
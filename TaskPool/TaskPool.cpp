@@ -0,0 +1,273 @@
+/**
+ * @file TaskPool.cpp
+ * @brief Work-stealing task pool shared by the parallel engines - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the TaskPool (worker loop, local
+ * pops and stealing, the shared instance), TaskGroup and parallelFor.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "TaskPool.h"
+#include <algorithm>
+
+namespace
+{
+    // Pool and index of the calling thread; null / -1 outside any pool
+    thread_local TaskPool *currentPool = nullptr;
+    thread_local int currentIndex = -1;
+
+    std::mutex sharedMutex;
+    std::unique_ptr<TaskPool> sharedPool;
+    int sharedThreadCount = 0; // 0 = hardware concurrency
+}
+
+//==============================================================================
+// TaskPool
+//==============================================================================
+
+TaskPool::TaskPool(int threadCount) : queuedTasks(0), nextQueue(0), stopping(false)
+{
+    int count = std::max(1, threadCount);
+    for (int i = 0; i < count; ++i)
+    {
+        queues.emplace_back(new WorkerQueue());
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        threads.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void TaskPool::submit(Task task)
+{
+    // Workers push onto their own deque; other threads spread round-robin
+    size_t target = isWorkerThread() ? static_cast<size_t>(currentIndex)
+                                     : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+    queuedTasks.fetch_add(1);
+
+    // Taking the lock orders this wake-up after a sleeper's predicate check
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeUp.notify_one();
+}
+
+bool TaskPool::takeTask(int index, Task &task)
+{
+    // Own deque first, newest task (still warm in cache)
+    {
+        WorkerQueue &own = *queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Then steal the oldest task of another worker
+    int count = static_cast<int>(queues.size());
+    for (int offset = 1; offset < count; ++offset)
+    {
+        WorkerQueue &victim = *queues[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queuedTasks.fetch_sub(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskPool::workerLoop(int index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    Task task;
+    while (true)
+    {
+        if (takeTask(index, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this]()
+                    { return stopping || queuedTasks.load() > 0; });
+        if (stopping && queuedTasks.load() == 0)
+            return;
+    }
+}
+
+bool TaskPool::runPendingTask()
+{
+    if (!isWorkerThread())
+        return false;
+
+    Task task;
+    if (!takeTask(currentIndex, task))
+        return false;
+    task();
+    return true;
+}
+
+bool TaskPool::isWorkerThread() const
+{
+    return currentPool == this;
+}
+
+int TaskPool::workerIndex()
+{
+    return currentIndex;
+}
+
+TaskPool &TaskPool::shared()
+{
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    if (!sharedPool)
+    {
+        int count = sharedThreadCount;
+        if (count <= 0)
+            count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        sharedPool.reset(new TaskPool(count));
+    }
+    return *sharedPool;
+}
+
+bool TaskPool::setSharedThreadCount(int threadCount)
+{
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    if (sharedPool)
+        return false;
+    sharedThreadCount = std::max(1, threadCount);
+    return true;
+}
+
+//==============================================================================
+// TaskGroup
+//==============================================================================
+
+TaskGroup::TaskGroup(TaskPool &taskPool) : pool(taskPool), pending(0), cancelled(false)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+void TaskGroup::run(const TaskPool::Task &task)
+{
+    pending.fetch_add(1);
+    pool.submit([this, task]()
+                {
+                    if (!isCancelled())
+                        task();
+                    finishTask(); });
+}
+
+void TaskGroup::finishTask()
+{
+    // Signalled under the lock so a waiter cannot destroy the group mid-notify
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.fetch_sub(1) == 1)
+        done.notify_all();
+}
+
+void TaskGroup::wait()
+{
+    if (pool.isWorkerThread())
+    {
+        // Keep this worker busy instead of blocking it
+        while (pending.load() > 0)
+        {
+            if (!pool.runPendingTask())
+                std::this_thread::yield();
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]()
+              { return pending.load() == 0; });
+}
+
+void TaskGroup::cancel()
+{
+    cancelled.store(true);
+}
+
+//==============================================================================
+// parallelFor
+//==============================================================================
+
+void parallelFor(TaskPool &pool, size_t begin, size_t end, size_t grain,
+                 const std::function<void(size_t, size_t)> &body)
+{
+    if (begin >= end)
+        return;
+
+    size_t chunk = std::max<size_t>(1, grain);
+    TaskGroup group(pool);
+    for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += chunk)
+    {
+        size_t chunkEnd = std::min(end, chunkBegin + chunk);
+        group.run([&body, chunkBegin, chunkEnd]()
+                  { body(chunkBegin, chunkEnd); });
+    }
+    group.wait();
+}
+
+void parallelFor(TaskPool &pool, size_t begin, size_t end, size_t grain, int maxTasks,
+                 const std::function<void(size_t, size_t)> &body)
+{
+    if (begin >= end)
+        return;
+
+    // Each task claims chunks from a shared cursor until none are left, so only that many run at once
+    size_t chunk = std::max<size_t>(1, grain);
+    size_t chunks = (end - begin + chunk - 1) / chunk;
+    size_t tasks = std::min(chunks, static_cast<size_t>(std::max(1, std::min(maxTasks, pool.size()))));
+    std::atomic<size_t> nextChunk(0);
+    TaskGroup group(pool);
+    for (size_t task = 0; task < tasks; ++task)
+    {
+        group.run([&]()
+                  {
+                      for (size_t index = nextChunk++; index < chunks; index = nextChunk++)
+                      {
+                          size_t chunkBegin = begin + index * chunk;
+                          body(chunkBegin, std::min(end, chunkBegin + chunk));
+                      } });
+    }
+    group.wait();
+}
@@ -0,0 +1,235 @@
+/**
+ * @file TaskPool.h
+ * @brief Work-stealing task pool shared by the parallel engines - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the TaskPool, a fixed set of worker threads with one
+ * task deque each, and TaskGroup, which tracks a set of related tasks so they
+ * can be awaited or cancelled together. Batch queries, the request scheduler,
+ * multi-unit solving and preprocessing all run on one shared pool instead of
+ * spawning their own threads.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef TASKPOOL_H
+#define TASKPOOL_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Fixed-size pool of worker threads with per-worker deques and work stealing
+ *
+ * A task submitted from a worker goes to the back of that worker's own deque
+ * and is taken from the back again (most recent first, for cache locality).
+ * Idle workers steal from the front of other deques (oldest first, usually the
+ * largest remaining pieces of work). Tasks submitted from other threads are
+ * spread over the deques round-robin.
+ *
+ * Tasks must not throw. Each worker has a stable index in [0, size()), so
+ * callers can keep per-worker state such as a private PathFinder copy in a
+ * vector indexed by workerIndex(). A task that waits on a nested TaskGroup
+ * may run other tasks on the same worker meanwhile, so it must not hold such
+ * per-worker state across the wait.
+ *
+ * @par Usage Example:
+ * @code
+ * TaskPool &pool = TaskPool::shared();
+ * std::vector<PathFinder> engines(pool.size(), pathfinder);
+ * TaskGroup group(pool);
+ * for (size_t i = 0; i < queries.size(); ++i)
+ *     group.run([&, i]() { results[i] = engines[TaskPool::workerIndex()].findPathAStar(queries[i].start, queries[i].target); });
+ * group.wait();
+ * @endcode
+ */
+class TaskPool
+{
+public:
+    typedef std::function<void()> Task; ///< Unit of work
+
+private:
+    /**
+     * @brief Task deque owned by one worker
+     */
+    struct WorkerQueue
+    {
+        std::mutex mutex;       ///< Guards tasks
+        std::deque<Task> tasks; ///< Owner uses the back, thieves the front
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues; ///< One deque per worker
+    std::vector<std::thread> threads;                 ///< Worker threads
+    std::atomic<int> queuedTasks;                     ///< Tasks in all deques
+    std::atomic<unsigned> nextQueue;                  ///< Round-robin target for external submissions
+    std::mutex sleepMutex;                            ///< Guards sleeping and stopping
+    std::condition_variable wakeUp;                   ///< Signals new tasks or shutdown
+    bool stopping;                                    ///< Set by the destructor
+
+    /**
+     * @brief Worker thread main loop
+     * @param index Worker index
+     */
+    void workerLoop(int index);
+
+    /**
+     * @brief Pop a task from the worker's own deque or steal one from another
+     * @param index Worker index of the calling thread
+     * @param task Receives the task
+     * @return true if a task was obtained
+     */
+    bool takeTask(int index, Task &task);
+
+public:
+    /**
+     * @brief Start a pool
+     * @param threadCount Number of worker threads (minimum 1)
+     */
+    explicit TaskPool(int threadCount);
+
+    /**
+     * @brief Run the remaining queued tasks and join the workers
+     */
+    ~TaskPool();
+
+    TaskPool(const TaskPool &) = delete;
+    TaskPool &operator=(const TaskPool &) = delete;
+
+    /**
+     * @brief Queue a task
+     * @param task Task to run on some worker
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Run one queued task on the calling worker if any is available
+     * @return true if a task was run
+     *
+     * Only has an effect when called from one of this pool's workers; used by
+     * TaskGroup::wait() so that waiting inside a task keeps the worker busy.
+     */
+    bool runPendingTask();
+
+    /**
+     * @brief Get the number of worker threads
+     */
+    int size() const { return static_cast<int>(threads.size()); }
+
+    /**
+     * @brief Check whether the calling thread is one of this pool's workers
+     */
+    bool isWorkerThread() const;
+
+    /**
+     * @brief Get the worker index of the calling thread
+     * @return Index in [0, size()) of the pool the thread belongs to, or -1 outside any pool
+     */
+    static int workerIndex();
+
+    /**
+     * @brief Get the process-wide pool, creating it on first use
+     * @return Shared pool sized by setSharedThreadCount() or the hardware concurrency
+     */
+    static TaskPool &shared();
+
+    /**
+     * @brief Choose the size of the shared pool
+     * @param threadCount Number of worker threads (minimum 1)
+     * @return false if the shared pool already exists (its size is then unchanged)
+     */
+    static bool setSharedThreadCount(int threadCount);
+};
+
+/**
+ * @brief Set of tasks that are awaited or cancelled together
+ *
+ * wait() returns once every task started through run() has finished or been
+ * skipped. Called on a pool worker (a task waiting for nested tasks), it runs
+ * queued tasks while waiting, so nested groups never deadlock the pool.
+ * cancel() skips tasks that have not started yet; running tasks can poll
+ * isCancelled() to stop early.
+ */
+class TaskGroup
+{
+private:
+    TaskPool &pool;               ///< Pool executing the tasks
+    std::atomic<int> pending;     ///< Tasks not finished yet
+    std::atomic<bool> cancelled;  ///< Set by cancel()
+    std::mutex mutex;             ///< Guards completion signalling
+    std::condition_variable done; ///< Signals pending reaching zero
+
+    /**
+     * @brief Mark one task as finished
+     */
+    void finishTask();
+
+public:
+    /**
+     * @brief Create an empty group
+     * @param taskPool Pool executing the tasks
+     */
+    explicit TaskGroup(TaskPool &taskPool = TaskPool::shared());
+
+    /**
+     * @brief Wait for all tasks before the group goes away
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    /**
+     * @brief Start a task in this group
+     * @param task Task to run (skipped if the group is cancelled before it starts)
+     */
+    void run(const TaskPool::Task &task);
+
+    /**
+     * @brief Wait until every task of the group has finished or been skipped
+     */
+    void wait();
+
+    /**
+     * @brief Skip all tasks of the group that have not started
+     */
+    void cancel();
+
+    /**
+     * @brief Check whether cancel() was called
+     */
+    bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Run body over [begin, end) in chunks of at most grain indices on a pool
+ * @param pool Pool executing the chunks
+ * @param begin First index
+ * @param end One past the last index
+ * @param grain Maximum indices per task (minimum 1)
+ * @param body Called as body(chunkBegin, chunkEnd) for each chunk, always on a pool worker
+ */
+void parallelFor(TaskPool &pool, size_t begin, size_t end, size_t grain,
+                 const std::function<void(size_t, size_t)> &body);
+
+/**
+ * @brief Run body over [begin, end) in chunks of at most grain indices, with at most maxTasks running at once
+ * @param pool Pool executing the chunks
+ * @param begin First index
+ * @param end One past the last index
+ * @param grain Maximum indices per chunk (minimum 1)
+ * @param maxTasks Maximum chunks in flight, and so threads used (capped at the pool size, minimum 1)
+ * @param body Called as body(chunkBegin, chunkEnd) for each chunk, always on a pool worker
+ */
+void parallelFor(TaskPool &pool, size_t begin, size_t end, size_t grain, int maxTasks,
+                 const std::function<void(size_t, size_t)> &body);
+
+#endif // TASKPOOL_H
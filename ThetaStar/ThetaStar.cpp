@@ -0,0 +1,343 @@
+/**
+ * @file ThetaStar.cpp
+ * @brief Any-angle Theta* and Lazy Theta* search with path smoothing - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of the ThetaStar engine: the packed
+ * passability bitplane, the supercover line-of-sight walk, Theta* and Lazy
+ * Theta* over 8-neighbor expansions, string pulling and waypoint expansion.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "ThetaStar.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace
+{
+    // Right, down, left, up, then the diagonals
+    const int DX[8] = {1, 0, -1, 0, 1, -1, -1, 1};
+    const int DY[8] = {0, 1, 0, -1, 1, 1, -1, -1};
+
+    // Slack for comparing sums of square roots
+    const double COST_EPSILON = 1e-9;
+
+    double distance(int ax, int ay, int bx, int by)
+    {
+        double dx = ax - bx;
+        double dy = ay - by;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    /**
+     * Walk the tiles a segment between tile centers passes through
+     * (visit(x, y) returns false to stop). A step through an exact corner
+     * visits the tile beside it in x first, then the one in y, then the
+     * diagonal tile. Returns false if visit stopped the walk.
+     */
+    template <typename Visit>
+    bool walkSegment(int x0, int y0, int x1, int y1, Visit visit)
+    {
+        int nx = std::abs(x1 - x0);
+        int ny = std::abs(y1 - y0);
+        int sx = x1 > x0 ? 1 : -1;
+        int sy = y1 > y0 ? 1 : -1;
+        int x = x0;
+        int y = y0;
+        for (int ix = 0, iy = 0; ix < nx || iy < ny;)
+        {
+            // Compare where the line crosses the next vertical and horizontal grid lines
+            long long decision = static_cast<long long>(1 + 2 * ix) * ny - static_cast<long long>(1 + 2 * iy) * nx;
+            if (decision == 0)
+            {
+                if (!visit(x + sx, y) || !visit(x, y + sy))
+                    return false;
+                x += sx;
+                y += sy;
+                ix++;
+                iy++;
+            }
+            else if (decision < 0)
+            {
+                x += sx;
+                ix++;
+            }
+            else
+            {
+                y += sy;
+                iy++;
+            }
+            if (!visit(x, y))
+                return false;
+        }
+        return true;
+    }
+}
+
+ThetaStar::ThetaStar(const PathFinder &engine)
+    : pathfinder(engine), planeVersion(0), planeBuilt(false), width(0), height(0), wordsPerRow(0),
+      searchId(0), lastPathLength(-1.0), lineOfSightChecks(0)
+{
+}
+
+bool ThetaStar::refreshPlane()
+{
+    if (!pathfinder.isMapLoaded())
+        return false;
+    if (planeBuilt && planeVersion == pathfinder.getMapVersion())
+        return true;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    height = map.height;
+    wordsPerRow = (width + 63) / 64;
+    plane.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    for (int y = 0; y < height; ++y)
+    {
+        uint64_t *row = &plane[static_cast<size_t>(y) * wordsPerRow];
+        for (int x = 0; x < width; ++x)
+        {
+            if (map.isReachable(x, y))
+                row[x >> 6] |= uint64_t(1) << (x & 63);
+        }
+    }
+
+    planeVersion = pathfinder.getMapVersion();
+    planeBuilt = true;
+    return true;
+}
+
+bool ThetaStar::rowPassable(int y, int fromX, int toX) const
+{
+    if (fromX > toX)
+        std::swap(fromX, toX);
+    const uint64_t *row = &plane[static_cast<size_t>(y) * wordsPerRow];
+    for (int word = fromX >> 6; word <= (toX >> 6); ++word)
+    {
+        int low = std::max(fromX, word << 6) & 63;
+        int high = std::min(toX, (word << 6) + 63) & 63;
+        uint64_t mask = (high == 63 ? ~uint64_t(0) : ((uint64_t(1) << (high + 1)) - 1)) & ~((uint64_t(1) << low) - 1);
+        if ((row[word] & mask) != mask)
+            return false;
+    }
+    return true;
+}
+
+bool ThetaStar::lineOfSight(const Position &from, const Position &to)
+{
+    if (!refreshPlane() || !passable(from.x, from.y) || !passable(to.x, to.y))
+        return false;
+    if (from.y == to.y)
+        return rowPassable(from.y, from.x, to.x);
+    return walkSegment(from.x, from.y, to.x, to.y, [this](int x, int y)
+                       { return passable(x, y); });
+}
+
+bool ThetaStar::visible(int from, int to)
+{
+    lineOfSightChecks++;
+    return lineOfSight(Position(from % width, from / width), Position(to % width, to / width));
+}
+
+std::vector<Position> ThetaStar::findPath(const Position &start, const Position &target, ThetaMode mode)
+{
+    lastSearchStats = SearchStats();
+    lastPathLength = -1.0;
+    lineOfSightChecks = 0;
+    if (!refreshPlane() || !passable(start.x, start.y) || !passable(target.x, target.y))
+        return {};
+
+    size_t tileCount = static_cast<size_t>(width) * height;
+    if (stamp.size() != tileCount)
+    {
+        gCost.assign(tileCount, 0.0);
+        parent.assign(tileCount, -1);
+        stamp.assign(tileCount, 0);
+        closed.assign(tileCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+
+    int startIndex = start.y * width + start.x;
+    int targetIndex = target.y * width + target.x;
+
+    // Moves to the 8 neighbors; a diagonal needs both tiles beside it, like a segment through a corner
+    auto canStep = [&](int x, int y, int direction)
+    {
+        int nx = x + DX[direction];
+        int ny = y + DY[direction];
+        if (!passable(nx, ny))
+            return false;
+        return direction < 4 || (passable(nx, y) && passable(x, ny));
+    };
+    auto cost = [&](int a, int b)
+    {
+        return distance(a % width, a / width, b % width, b / width);
+    };
+
+    stamp[startIndex] = searchId;
+    gCost[startIndex] = 0.0;
+    parent[startIndex] = startIndex;
+    closed[startIndex] = 0;
+    open.clear();
+    OpenEntry first = {cost(startIndex, targetIndex), 0.0, startIndex};
+    open.push_back(first);
+    lastSearchStats.nodesGenerated = 1;
+
+    bool found = false;
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.index;
+        if (closed[current] || entry.g > gCost[current] + COST_EPSILON)
+            continue;
+
+        int x = current % width;
+        int y = current / width;
+
+        // Lazy Theta*: the assumed shortcut failed, fall back to the best expanded neighbor
+        if (mode == ThetaMode::LAZY && parent[current] != current && !visible(parent[current], current))
+        {
+            double best = std::numeric_limits<double>::max();
+            for (int direction = 0; direction < 8; ++direction)
+            {
+                if (!canStep(x, y, direction))
+                    continue;
+                int neighbor = (y + DY[direction]) * width + x + DX[direction];
+                if (stamp[neighbor] != searchId || !closed[neighbor])
+                    continue;
+                double candidate = gCost[neighbor] + cost(neighbor, current);
+                if (candidate < best)
+                {
+                    best = candidate;
+                    parent[current] = neighbor;
+                }
+            }
+            gCost[current] = best;
+        }
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        if (current == targetIndex)
+        {
+            found = true;
+            break;
+        }
+
+        for (int direction = 0; direction < 8; ++direction)
+        {
+            if (!canStep(x, y, direction))
+                continue;
+
+            int neighbor = (y + DY[direction]) * width + x + DX[direction];
+            if (stamp[neighbor] != searchId)
+            {
+                stamp[neighbor] = searchId;
+                closed[neighbor] = 0;
+                gCost[neighbor] = std::numeric_limits<double>::max();
+            }
+            else if (closed[neighbor])
+            {
+                continue;
+            }
+
+            // Link to the grandparent when it can (or, lazily, is assumed to) see the neighbor
+            int from = current;
+            int grandparent = parent[current];
+            if (grandparent != current && (mode == ThetaMode::LAZY || visible(grandparent, neighbor)))
+                from = grandparent;
+
+            double candidate = gCost[from] + cost(from, neighbor);
+            if (candidate + COST_EPSILON >= gCost[neighbor])
+                continue;
+
+            gCost[neighbor] = candidate;
+            parent[neighbor] = from;
+            OpenEntry next = {candidate + cost(neighbor, targetIndex), candidate, neighbor};
+            open.push_back(next);
+            std::push_heap(open.begin(), open.end());
+            lastSearchStats.nodesGenerated++;
+        }
+    }
+
+    if (!found)
+        return {};
+
+    std::vector<Position> waypoints;
+    for (int index = targetIndex;; index = parent[index])
+    {
+        waypoints.push_back(Position(index % width, index / width));
+        if (parent[index] == index)
+            break;
+    }
+    std::reverse(waypoints.begin(), waypoints.end());
+
+    lastPathLength = gCost[targetIndex];
+    lastSearchStats.pathCost = static_cast<int>(std::lround(lastPathLength));
+    return waypoints;
+}
+
+std::vector<Position> ThetaStar::smoothPath(const std::vector<Position> &path)
+{
+    if (path.size() < 3)
+        return path;
+
+    // The anchor always sees path[i]; keep path[i] only when the anchor cannot see past it
+    std::vector<Position> waypoints;
+    waypoints.push_back(path.front());
+    size_t anchor = 0;
+    for (size_t i = 1; i + 1 < path.size(); ++i)
+    {
+        if (!lineOfSight(path[anchor], path[i + 1]))
+        {
+            waypoints.push_back(path[i]);
+            anchor = i;
+        }
+    }
+    waypoints.push_back(path.back());
+    return waypoints;
+}
+
+std::vector<Position> ThetaStar::expandWaypoints(const std::vector<Position> &waypoints)
+{
+    std::vector<Position> tiles;
+    if (waypoints.empty())
+        return tiles;
+
+    tiles.push_back(waypoints.front());
+    for (size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+        // A corner step visits the x-side, y-side and diagonal tiles; keeping only
+        // tiles adjacent to the last one drops the y-side tile
+        const Position &from = waypoints[i];
+        const Position &to = waypoints[i + 1];
+        walkSegment(from.x, from.y, to.x, to.y, [&](int x, int y)
+                    {
+                        const Position &last = tiles.back();
+                        if (std::abs(last.x - x) + std::abs(last.y - y) == 1)
+                            tiles.push_back(Position(x, y));
+                        return true; });
+    }
+    return tiles;
+}
+
+double ThetaStar::pathLength(const std::vector<Position> &waypoints)
+{
+    double length = 0.0;
+    for (size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+        length += distance(waypoints[i].x, waypoints[i].y, waypoints[i + 1].x, waypoints[i + 1].y);
+    }
+    return length;
+}
@@ -0,0 +1,190 @@
+/**
+ * @file ThetaStar.h
+ * @brief Any-angle Theta* and Lazy Theta* search with path smoothing - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines the ThetaStar engine. It returns compact waypoint
+ * lists whose segments run at any angle instead of following Manhattan
+ * staircases. The same line-of-sight test, run on a packed passability
+ * bitplane, also drives a string-pulling smoother for paths from the other
+ * engines.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef THETASTAR_H
+#define THETASTAR_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief How parent shortcuts are checked during search
+ */
+enum class ThetaMode
+{
+    THETA, ///< Check line of sight for every generated tile (Theta*)
+    LAZY   ///< Assume line of sight and check only on expansion (Lazy Theta*)
+};
+
+/**
+ * @brief Any-angle search and path smoothing over tile centers
+ *
+ * Waypoints are tile centers. A segment between two waypoints is walkable
+ * when every tile it passes through is reachable. Where it passes exactly
+ * through a tile corner, both tiles beside the corner must be reachable, so
+ * a segment never squeezes between two diagonal obstacles. Every waypoint
+ * path can therefore be expanded back into a 4-connected tile path with
+ * expandWaypoints().
+ *
+ * Theta* runs A* over the 8 neighbors of each tile with Euclidean costs.
+ * When the parent of the current tile can see a new neighbor, the neighbor
+ * is linked straight to that parent. Lazy Theta* defers the line-of-sight
+ * check until a tile is expanded, which saves most of the checks. Paths are
+ * not guaranteed to be the shortest any-angle paths, but are usually within
+ * a fraction of a percent of them.
+ *
+ * @par Usage Example:
+ * @code
+ * ThetaStar theta(pathfinder);
+ * std::vector<Position> waypoints = theta.findPath(start, target);        // Lazy Theta*
+ * std::vector<Position> corners = theta.smoothPath(pathfinder.findPathAStar(start, target));
+ * std::vector<Position> tiles = ThetaStar::expandWaypoints(waypoints);    // Back to 4-connected steps
+ * @endcode
+ *
+ * @note The bitplane is rebuilt automatically when the PathFinder's map
+ *       version changes. Queries on one instance are not thread safe.
+ */
+class ThetaStar
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        double f;  ///< g + h
+        double g;  ///< Cost from the start, higher wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing the map
+    uint64_t planeVersion;        ///< Map version the bitplane was built from
+    bool planeBuilt;              ///< true once the bitplane exists
+    int width;                    ///< Map width of the bitplane
+    int height;                   ///< Map height of the bitplane
+    int wordsPerRow;              ///< 64-bit words per bitplane row
+    std::vector<uint64_t> plane;  ///< Reachable bit per tile, one padded row of words per map row
+
+    std::vector<double> gCost;   ///< Cost per tile, valid where stamp matches
+    std::vector<int> parent;     ///< Parent tile per tile (the start is its own parent)
+    std::vector<uint32_t> stamp; ///< Search id that last touched each tile
+    std::vector<uint8_t> closed; ///< Expanded flag, valid where stamp matches
+    std::vector<OpenEntry> open; ///< Binary heap of open entries
+    uint32_t searchId;           ///< Current search id
+    SearchStats lastSearchStats; ///< Effort of the last search
+    double lastPathLength;       ///< Euclidean length of the last path (-1 if none)
+    size_t lineOfSightChecks;    ///< Line-of-sight tests run by the last search
+
+    /**
+     * @brief Rebuild the bitplane if the map changed
+     * @return false if no map is loaded
+     */
+    bool refreshPlane();
+
+    /**
+     * @brief Read one bit of the bitplane (false outside the map)
+     */
+    bool passable(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return false;
+        return (plane[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    /**
+     * @brief Check whether a horizontal run of tiles is reachable, a word at a time
+     */
+    bool rowPassable(int y, int fromX, int toX) const;
+
+    /**
+     * @brief Line of sight between tile indices, counted in the search stats
+     */
+    bool visible(int from, int to);
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit ThetaStar(const PathFinder &engine);
+
+    /**
+     * @brief Find an any-angle path
+     * @param start Start position
+     * @param target Target position
+     * @param mode Theta* or Lazy Theta*
+     * @return Waypoints from start to target (both included), empty if no path exists
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target, ThetaMode mode = ThetaMode::LAZY);
+
+    /**
+     * @brief Shorten a walkable path by string pulling
+     * @param path Tile path or waypoint list whose segments are walkable
+     * @return Waypoints keeping only the tiles where the path must turn
+     *
+     * Each waypoint is joined to the farthest later point it can see. Runs in
+     * one pass, with one line-of-sight test per input point.
+     */
+    std::vector<Position> smoothPath(const std::vector<Position> &path);
+
+    /**
+     * @brief Check whether the segment between two tile centers is walkable
+     * @param from First tile
+     * @param to Second tile
+     * @return true if every tile the segment passes through is reachable
+     */
+    bool lineOfSight(const Position &from, const Position &to);
+
+    /**
+     * @brief Turn waypoints into the 4-connected tiles their segments pass through
+     * @param waypoints Waypoints with walkable segments
+     * @return Tile path from the first to the last waypoint
+     */
+    static std::vector<Position> expandWaypoints(const std::vector<Position> &waypoints);
+
+    /**
+     * @brief Euclidean length of a waypoint list
+     */
+    static double pathLength(const std::vector<Position> &waypoints);
+
+    /**
+     * @brief Get search effort of the last findPath() call (pathCost is the rounded Euclidean length)
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+
+    /**
+     * @brief Get the Euclidean length of the last findPath() result, or -1 if none was found
+     */
+    double getLastPathLength() const { return lastPathLength; }
+
+    /**
+     * @brief Get the number of line-of-sight tests run by the last findPath() call
+     */
+    size_t getLastLineOfSightChecks() const { return lineOfSightChecks; }
+};
+
+#endif // THETASTAR_H
@@ -0,0 +1,209 @@
+/**
+ * @file TimeSlicedSearch.cpp
+ * @brief Resumable A* search for per-frame time budgets - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of TimeSlicedSearch (A* over flat
+ * per-tile arrays with a lazily cleaned binary heap) and SearchSlicer
+ * (round-robin interleaving of many searches).
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "TimeSlicedSearch.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    // Deadline checks are amortized over this many expansions
+    const int CLOCK_CHECK_INTERVAL = 64;
+}
+
+//==============================================================================
+// TimeSlicedSearch
+//==============================================================================
+
+TimeSlicedSearch::TimeSlicedSearch(const PathFinder &pathfinder, const Position &startPos, const Position &targetPos)
+    : map(pathfinder.getBattleMap()), moveDirections(pathfinder.getMoveDirections()),
+      start(startPos), target(targetPos), status(SearchStatus::IN_PROGRESS)
+{
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+    {
+        status = SearchStatus::FAILED;
+        return;
+    }
+
+    size_t tileCount = static_cast<size_t>(map.width) * map.height;
+    gCost.assign(tileCount, -1);
+    parent.assign(tileCount, -1);
+    closed.assign(tileCount, 0);
+
+    int startIndex = start.y * map.width + start.x;
+    gCost[startIndex] = 0;
+    OpenEntry entry = {heuristic(startIndex), heuristic(startIndex), startIndex};
+    open.push_back(entry);
+    stats.nodesGenerated = 1;
+}
+
+int TimeSlicedSearch::heuristic(int index) const
+{
+    return std::abs(index % map.width - target.x) + std::abs(index / map.width - target.y);
+}
+
+SearchStatus TimeSlicedSearch::expandOne()
+{
+    // Skip entries made stale by a later, cheaper push of the same tile
+    while (!open.empty() && closed[open.front().index])
+    {
+        std::pop_heap(open.begin(), open.end());
+        open.pop_back();
+    }
+
+    if (open.empty())
+    {
+        status = SearchStatus::FAILED;
+        return status;
+    }
+
+    std::pop_heap(open.begin(), open.end());
+    int current = open.back().index;
+    open.pop_back();
+
+    closed[current] = 1;
+    stats.nodesExpanded++;
+
+    int x = current % map.width;
+    int y = current / map.width;
+    if (x == target.x && y == target.y)
+    {
+        stats.pathCost = gCost[current];
+        status = SearchStatus::FOUND;
+        open.clear();
+        open.shrink_to_fit();
+        return status;
+    }
+
+    int nextCost = gCost[current] + 1;
+    for (const auto &direction : moveDirections)
+    {
+        int nx = x + direction.first;
+        int ny = y + direction.second;
+        if (!map.isReachable(nx, ny))
+            continue;
+
+        int neighbor = ny * map.width + nx;
+        if (closed[neighbor] || (gCost[neighbor] >= 0 && gCost[neighbor] <= nextCost))
+            continue;
+
+        gCost[neighbor] = nextCost;
+        parent[neighbor] = current;
+        int h = heuristic(neighbor);
+        OpenEntry entry = {nextCost + h, h, neighbor};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        stats.nodesGenerated++;
+    }
+
+    return status;
+}
+
+SearchStatus TimeSlicedSearch::step(int maxExpansions)
+{
+    int budget = std::max(1, maxExpansions);
+    for (int i = 0; i < budget && status == SearchStatus::IN_PROGRESS; ++i)
+    {
+        expandOne();
+    }
+    return status;
+}
+
+SearchStatus TimeSlicedSearch::step(Clock::time_point deadline)
+{
+    while (status == SearchStatus::IN_PROGRESS)
+    {
+        step(CLOCK_CHECK_INTERVAL);
+        if (Clock::now() >= deadline)
+            break;
+    }
+    return status;
+}
+
+void TimeSlicedSearch::cancel()
+{
+    if (status == SearchStatus::IN_PROGRESS)
+        status = SearchStatus::FAILED;
+
+    std::vector<int>().swap(gCost);
+    std::vector<int>().swap(parent);
+    std::vector<uint8_t>().swap(closed);
+    std::vector<OpenEntry>().swap(open);
+}
+
+std::vector<Position> TimeSlicedSearch::getPath() const
+{
+    std::vector<Position> path;
+    if (status != SearchStatus::FOUND || parent.empty())
+        return path;
+
+    for (int index = target.y * map.width + target.x; index >= 0; index = parent[index])
+    {
+        path.push_back(Position(index % map.width, index / map.width));
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+//==============================================================================
+// SearchSlicer
+//==============================================================================
+
+SearchSlicer::SearchSlicer(int expansionsPerSlice) : sliceExpansions(std::max(1, expansionsPerSlice))
+{
+}
+
+void SearchSlicer::add(const std::shared_ptr<TimeSlicedSearch> &search)
+{
+    if (search && search->getStatus() == SearchStatus::IN_PROGRESS)
+        active.push_back(search);
+}
+
+size_t SearchSlicer::runFrame(TimeSlicedSearch::Clock::time_point deadline)
+{
+    size_t finished = 0;
+    while (!active.empty() && TimeSlicedSearch::Clock::now() < deadline)
+    {
+        std::shared_ptr<TimeSlicedSearch> search = active.front();
+        active.pop_front();
+
+        if (search->step(sliceExpansions) == SearchStatus::IN_PROGRESS)
+            active.push_back(search); // Back of the rotation
+        else
+            finished++;
+    }
+    return finished;
+}
+
+size_t SearchSlicer::runFrame(int expansionBudget)
+{
+    size_t finished = 0;
+    int remaining = expansionBudget;
+    while (!active.empty() && remaining > 0)
+    {
+        std::shared_ptr<TimeSlicedSearch> search = active.front();
+        active.pop_front();
+
+        int before = search->getStats().nodesExpanded;
+        SearchStatus status = search->step(std::min(sliceExpansions, remaining));
+        remaining -= std::max(1, search->getStats().nodesExpanded - before);
+
+        if (status == SearchStatus::IN_PROGRESS)
+            active.push_back(search);
+        else
+            finished++;
+    }
+    return finished;
+}
@@ -0,0 +1,219 @@
+/**
+ * @file TimeSlicedSearch.h
+ * @brief Resumable A* search for per-frame time budgets - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines TimeSlicedSearch, an A* search handle that can be
+ * advanced a bounded number of expansions (or until a deadline) at a time and
+ * resumed later, and SearchSlicer, a round-robin scheduler that interleaves
+ * many such handles within a frame budget.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef TIMESLICEDSEARCH_H
+#define TIMESLICEDSEARCH_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief State of a resumable search
+ */
+enum class SearchStatus
+{
+    IN_PROGRESS, ///< More steps are needed
+    FOUND,       ///< A path was found; getPath() returns it
+    FAILED       ///< No path exists, the endpoints are invalid, or the search was cancelled
+};
+
+/**
+ * @brief A* search whose open and closed state persists between step() calls
+ *
+ * The search is equivalent to PathFinder::findPathAStar (Manhattan heuristic,
+ * unit costs, same move order) and returns an optimal path, but it can be
+ * paused after any expansion. Node state lives in flat arrays indexed by
+ * y * width + x, so a paused handle costs about 9 bytes per map tile.
+ *
+ * @par Usage Example:
+ * @code
+ * TimeSlicedSearch search(pathfinder, Position(28, 6), Position(0, 25));
+ * while (search.step(200) == SearchStatus::IN_PROGRESS) {
+ *     // ... render a frame, run other systems ...
+ * }
+ * std::vector<Position> path = search.getPath();
+ * @endcode
+ *
+ * @warning The PathFinder (and its map) must outlive the handle and must not
+ *          be reloaded while the search is in progress.
+ */
+class TimeSlicedSearch
+{
+public:
+    typedef std::chrono::steady_clock Clock; ///< Clock used for deadlines
+
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int h;     ///< Heuristic, lower wins ties
+        int index; ///< Tile index
+
+        /**
+         * @brief Heap ordering: lowest f first, then lowest h
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return h > other.h;
+        }
+    };
+
+    const BattleMap &map;                             ///< Map searched (owned by the PathFinder)
+    std::vector<std::pair<int, int>> moveDirections;  ///< Neighbor order copied from the PathFinder
+    Position start;                                   ///< Start tile
+    Position target;                                  ///< Target tile
+    SearchStatus status;                              ///< Current state
+    std::vector<int> gCost;                           ///< Best known cost per tile (-1 = unseen)
+    std::vector<int> parent;                          ///< Predecessor tile index (-1 = none)
+    std::vector<uint8_t> closed;                      ///< Expanded flag per tile
+    std::vector<OpenEntry> open;                      ///< Binary heap of open entries
+    SearchStats stats;                                ///< Effort so far
+
+    /**
+     * @brief Manhattan distance from a tile index to the target
+     */
+    int heuristic(int index) const;
+
+    /**
+     * @brief Expand one node
+     * @return Status after the expansion
+     */
+    SearchStatus expandOne();
+
+public:
+    /**
+     * @brief Prepare a search; no nodes are expanded until step() is called
+     * @param pathfinder Engine providing the map and move order
+     * @param startPos Start tile
+     * @param targetPos Target tile
+     *
+     * Invalid or blocked endpoints put the handle directly into FAILED.
+     */
+    TimeSlicedSearch(const PathFinder &pathfinder, const Position &startPos, const Position &targetPos);
+
+    /**
+     * @brief Advance the search by at most maxExpansions expansions
+     * @param maxExpansions Expansion budget for this call (at least one is performed)
+     * @return Status after the call
+     */
+    SearchStatus step(int maxExpansions);
+
+    /**
+     * @brief Advance the search until it finishes or the deadline passes
+     * @param deadline Point in time after which the call returns
+     * @return Status after the call
+     *
+     * The clock is read every 64 expansions to keep the overhead negligible.
+     */
+    SearchStatus step(Clock::time_point deadline);
+
+    /**
+     * @brief Abandon the search and release its node storage
+     */
+    void cancel();
+
+    /**
+     * @brief Get the current status
+     */
+    SearchStatus getStatus() const { return status; }
+
+    /**
+     * @brief Get the path once the status is FOUND
+     * @return Path from start to target, empty otherwise
+     */
+    std::vector<Position> getPath() const;
+
+    /**
+     * @brief Get search effort accumulated over all step() calls
+     */
+    const SearchStats &getStats() const { return stats; }
+
+    /**
+     * @brief Get the start tile
+     */
+    const Position &getStart() const { return start; }
+
+    /**
+     * @brief Get the target tile
+     */
+    const Position &getTarget() const { return target; }
+};
+
+/**
+ * @brief Round-robin scheduler interleaving many TimeSlicedSearch handles
+ *
+ * Each frame, active searches receive fixed slices of expansions in turn
+ * until the frame budget is used up, so no single long query can starve the
+ * others or the game loop. Finished searches are dropped from the rotation;
+ * callers keep their own shared_ptr to read the result.
+ *
+ * @par Usage Example:
+ * @code
+ * SearchSlicer slicer(256);
+ * std::shared_ptr<TimeSlicedSearch> search = std::make_shared<TimeSlicedSearch>(pathfinder, from, to);
+ * slicer.add(search);
+ * // Every frame:
+ * slicer.runFrame(TimeSlicedSearch::Clock::now() + std::chrono::milliseconds(2));
+ * @endcode
+ */
+class SearchSlicer
+{
+private:
+    std::deque<std::shared_ptr<TimeSlicedSearch>> active; ///< Searches in rotation order
+    int sliceExpansions;                                  ///< Expansions per turn
+
+public:
+    /**
+     * @brief Create a scheduler
+     * @param expansionsPerSlice Expansions a search may perform per turn
+     */
+    explicit SearchSlicer(int expansionsPerSlice = 256);
+
+    /**
+     * @brief Add a search to the rotation
+     * @param search Search handle (ignored if null or already finished)
+     */
+    void add(const std::shared_ptr<TimeSlicedSearch> &search);
+
+    /**
+     * @brief Run slices until every search finishes or the deadline passes
+     * @param deadline End of this frame's pathfinding budget
+     * @return Number of searches that finished during this call
+     */
+    size_t runFrame(TimeSlicedSearch::Clock::time_point deadline);
+
+    /**
+     * @brief Run slices until every search finishes or the expansion budget is used
+     * @param expansionBudget Total expansions allowed this frame
+     * @return Number of searches that finished during this call
+     */
+    size_t runFrame(int expansionBudget);
+
+    /**
+     * @brief Get the number of searches still in progress
+     */
+    size_t pending() const { return active.size(); }
+};
+
+#endif // TIMESLICEDSEARCH_H
@@ -0,0 +1,227 @@
+/**
+ * @file TurnAwareSearch.cpp
+ * @brief A* over (tile, heading) states with turn costs - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of TurnAwareSearch: the heading
+ * change costs, the turn-count lower bound used by the heuristic, and A*
+ * over flat per-state arrays indexed by tile * 4 + heading.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "TurnAwareSearch.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    // Headings per tile; states are tile * HEADINGS + heading
+    const int HEADINGS = 4;
+
+    /**
+     * @brief Heading index (0-3) of a unit step, or -1 if it is not one
+     */
+    int headingOf(int dx, int dy)
+    {
+        if (dx == 1 && dy == 0)
+            return static_cast<int>(Heading::RIGHT);
+        if (dx == 0 && dy == 1)
+            return static_cast<int>(Heading::DOWN);
+        if (dx == -1 && dy == 0)
+            return static_cast<int>(Heading::LEFT);
+        if (dx == 0 && dy == -1)
+            return static_cast<int>(Heading::UP);
+        return -1;
+    }
+}
+
+TurnAwareSearch::TurnAwareSearch(const PathFinder &engine)
+    : pathfinder(engine), turnCost(1), reverseCost(2), width(0), searchId(0), lastTurns(0)
+{
+}
+
+void TurnAwareSearch::setTurnCosts(int turn, int reverse)
+{
+    turnCost = std::max(0, turn);
+    reverseCost = std::max(0, reverse);
+}
+
+int TurnAwareSearch::headingChangeCost(int from, int to) const
+{
+    if (from == static_cast<int>(Heading::ANY) || from == to)
+        return 0;
+    return (from + 2) % HEADINGS == to ? reverseCost : turnCost;
+}
+
+int TurnAwareSearch::turnLowerBound(int heading, int dx, int dy) const
+{
+    int needX = dx > 0 ? static_cast<int>(Heading::RIGHT) : dx < 0 ? static_cast<int>(Heading::LEFT) : -1;
+    int needY = dy > 0 ? static_cast<int>(Heading::DOWN) : dy < 0 ? static_cast<int>(Heading::UP) : -1;
+    if (needX < 0 && needY < 0)
+        return 0;
+
+    if (needX < 0 || needY < 0)
+    {
+        // One direction left: free if facing it, else a turn, or a reversal done as one or two turns
+        int need = needX < 0 ? needY : needX;
+        if (heading == need)
+            return 0;
+        if ((heading + 2) % HEADINGS == need)
+            return std::min(reverseCost, 2 * turnCost);
+        return turnCost;
+    }
+
+    // Two directions left: facing one costs at least the turn to the other, facing away needs two changes
+    if (heading == needX || heading == needY)
+        return turnCost;
+    return std::min(2 * turnCost, reverseCost + turnCost);
+}
+
+std::vector<Position> TurnAwareSearch::findPath(const Position &start, const Position &target, Heading startHeading)
+{
+    lastSearchStats = SearchStats();
+    lastTurns = 0;
+    if (!pathfinder.isMapLoaded())
+        return {};
+    const BattleMap &map = pathfinder.getBattleMap();
+    if (!map.isReachable(start.x, start.y) || !map.isReachable(target.x, target.y))
+        return {};
+
+    size_t stateCount = static_cast<size_t>(map.width) * map.height * HEADINGS;
+    if (stamp.size() != stateCount || width != map.width)
+    {
+        width = map.width;
+        gCost.assign(stateCount, 0);
+        parent.assign(stateCount, -1);
+        stamp.assign(stateCount, 0);
+        closed.assign(stateCount, 0);
+        searchId = 0;
+    }
+    if (++searchId == 0)
+    {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        searchId = 1;
+    }
+
+    if (start == target)
+    {
+        lastSearchStats.pathCost = 0;
+        return {start};
+    }
+
+    int targetTile = target.y * width + target.x;
+    auto push = [&](int state, int from, int cost)
+    {
+        if (stamp[state] != searchId)
+        {
+            stamp[state] = searchId;
+            closed[state] = 0;
+        }
+        else if (closed[state] || gCost[state] <= cost)
+        {
+            return;
+        }
+        gCost[state] = cost;
+        parent[state] = from;
+        int tile = state / HEADINGS;
+        int dx = target.x - tile % width;
+        int dy = target.y - tile / width;
+        int h = std::abs(dx) + std::abs(dy) + turnLowerBound(state % HEADINGS, dx, dy);
+        OpenEntry entry = {cost + h, cost, state};
+        open.push_back(entry);
+        std::push_heap(open.begin(), open.end());
+        lastSearchStats.nodesGenerated++;
+    };
+
+    open.clear();
+    int startTile = start.y * width + start.x;
+    if (startHeading == Heading::ANY)
+    {
+        // Every heading is free at the start, so the first move costs no turn
+        for (int heading = 0; heading < HEADINGS; ++heading)
+        {
+            push(startTile * HEADINGS + heading, -1, 0);
+        }
+    }
+    else
+    {
+        push(startTile * HEADINGS + static_cast<int>(startHeading), -1, 0);
+    }
+
+    const std::vector<std::pair<int, int>> &directions = pathfinder.getMoveDirections();
+    while (!open.empty())
+    {
+        std::pop_heap(open.begin(), open.end());
+        OpenEntry entry = open.back();
+        open.pop_back();
+        int current = entry.state;
+        if (closed[current] || entry.g != gCost[current])
+            continue;
+
+        closed[current] = 1;
+        lastSearchStats.nodesExpanded++;
+        int tile = current / HEADINGS;
+        if (tile == targetTile)
+        {
+            std::vector<Position> path;
+            for (int state = current; state >= 0; state = parent[state])
+            {
+                int stateTile = state / HEADINGS;
+                path.push_back(Position(stateTile % width, stateTile / width));
+            }
+            std::reverse(path.begin(), path.end());
+            lastSearchStats.pathCost = entry.g;
+            lastTurns = countTurns(path, startHeading);
+            return path;
+        }
+
+        int heading = current % HEADINGS;
+        int x = tile % width;
+        int y = tile / width;
+        for (const auto &direction : directions)
+        {
+            int nx = x + direction.first;
+            int ny = y + direction.second;
+            if (!map.isReachable(nx, ny))
+                continue;
+            int moveHeading = headingOf(direction.first, direction.second);
+            int cost = entry.g + 1 + headingChangeCost(heading, moveHeading);
+            push((ny * width + nx) * HEADINGS + moveHeading, current, cost);
+        }
+    }
+    return {};
+}
+
+int TurnAwareSearch::pathCost(const std::vector<Position> &path, Heading startHeading) const
+{
+    int cost = 0;
+    int heading = static_cast<int>(startHeading);
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        int moveHeading = headingOf(path[i].x - path[i - 1].x, path[i].y - path[i - 1].y);
+        if (moveHeading < 0)
+            return -1;
+        cost += 1 + headingChangeCost(heading, moveHeading);
+        heading = moveHeading;
+    }
+    return cost;
+}
+
+int TurnAwareSearch::countTurns(const std::vector<Position> &path, Heading startHeading)
+{
+    int turns = 0;
+    int heading = static_cast<int>(startHeading);
+    for (size_t i = 1; i < path.size(); ++i)
+    {
+        int moveHeading = headingOf(path[i].x - path[i - 1].x, path[i].y - path[i - 1].y);
+        if (moveHeading < 0)
+            continue;
+        if (heading != static_cast<int>(Heading::ANY) && moveHeading != heading)
+            turns++;
+        heading = moveHeading;
+    }
+    return turns;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file TurnAwareSearch.h
+ * @brief A* over (tile, heading) states with turn costs - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines TurnAwareSearch, which finds cheapest paths for units
+ * that pay a time cost to change heading, such as tracked vehicles. Its
+ * state is a tile together with the direction the unit faces, stored in flat
+ * arrays indexed by tile * 4 + heading.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef TURNAWARESEARCH_H
+#define TURNAWARESEARCH_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @enum Heading
+ * @brief Direction a unit faces
+ */
+enum class Heading
+{
+    RIGHT = 0, ///< Facing +x
+    DOWN = 1,  ///< Facing +y
+    LEFT = 2,  ///< Facing -x
+    UP = 3,    ///< Facing -y
+    ANY = 4    ///< Unknown or free; the first move pays no turn cost
+};
+
+/**
+ * @brief Cheapest paths when changing heading costs time
+ *
+ * A move steps one tile in the PathFinder's move order and costs 1, plus
+ * the turn cost if its direction differs from the current heading by 90
+ * degrees, or the reverse cost if it is the opposite direction. After the
+ * move the unit faces the direction it moved in.
+ *
+ * The search is A* over (tile, heading) states. The heuristic is the
+ * Manhattan distance plus the fewest turns the remaining displacement
+ * forces from the current heading: none if the unit already faces the only
+ * direction it still has to go, one 90-degree turn if it has to go in two
+ * directions and faces one of them, and so on. The bound is admissible and
+ * consistent, so each state is expanded at most once.
+ *
+ * Per-state arrays are indexed by tile * 4 + heading, so the four states of
+ * a tile share a cache line. They are reused between searches and reset by
+ * search stamps rather than cleared.
+ *
+ * @par Usage Example:
+ * @code
+ * TurnAwareSearch tracks(pathfinder);
+ * tracks.setTurnCosts(2, 3);                          // 90-degree turn 2, reversal 3
+ * std::vector<Position> path = tracks.findPath(tank, objective, Heading::UP);
+ * int cost = tracks.getLastSearchStats().pathCost;    // Moves plus turn costs
+ * @endcode
+ *
+ * @note Queries on one instance are not thread safe.
+ */
+class TurnAwareSearch
+{
+private:
+    /**
+     * @brief Open list entry; stale entries are skipped when popped
+     */
+    struct OpenEntry
+    {
+        int f;     ///< g + h
+        int g;     ///< Cost from the start, higher wins ties
+        int state; ///< tile * 4 + heading
+
+        /**
+         * @brief Heap ordering: lowest f first, then highest g
+         */
+        bool operator<(const OpenEntry &other) const
+        {
+            if (f != other.f)
+                return f > other.f;
+            return g < other.g;
+        }
+    };
+
+    const PathFinder &pathfinder; ///< Engine providing map and move order
+    int turnCost;                 ///< Cost of a 90-degree heading change
+    int reverseCost;              ///< Cost of a 180-degree heading change
+    int width;                    ///< Map width of the buffers
+
+    std::vector<int> gCost;      ///< Cost per state, valid where stamp matches
+    std::vector<int> parent;     ///< Parent state per state (-1 for a start state)
+    std::vector<uint32_t> stamp; ///< Search id that last touched each state
+    std::vector<uint8_t> closed; ///< Expanded flag, valid where stamp matches
+    std::vector<OpenEntry> open; ///< Binary heap of open entries
+    uint32_t searchId;           ///< Current search id
+    SearchStats lastSearchStats; ///< Effort of the last search
+    int lastTurns;               ///< Heading changes on the last path
+
+    /**
+     * @brief Cost of moving in direction to while facing from
+     */
+    int headingChangeCost(int from, int to) const;
+
+    /**
+     * @brief Lower bound on the turn costs still needed to cover a displacement
+     * @param heading Current heading (0-3)
+     * @param dx Remaining x displacement
+     * @param dy Remaining y displacement
+     */
+    int turnLowerBound(int heading, int dx, int dy) const;
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     */
+    explicit TurnAwareSearch(const PathFinder &engine);
+
+    /**
+     * @brief Set the heading change costs
+     * @param turn Cost of a 90-degree turn (default 1, at least 0)
+     * @param reverse Cost of a 180-degree turn (default 2, at least 0)
+     */
+    void setTurnCosts(int turn, int reverse);
+
+    /**
+     * @brief Find the cheapest path counting moves and heading changes
+     * @param start Start position
+     * @param target Target position (reached in any heading)
+     * @param startHeading Heading at the start, or Heading::ANY if the first move is free to pick one
+     * @return Path from start to target (both included), empty if no path exists
+     */
+    std::vector<Position> findPath(const Position &start, const Position &target,
+                                   Heading startHeading = Heading::ANY);
+
+    /**
+     * @brief Cost of following a path with the current turn costs
+     * @param path Consecutive 4-connected positions
+     * @param startHeading Heading at the start of the path
+     * @return Moves plus heading change costs, or -1 if two consecutive positions are not adjacent
+     */
+    int pathCost(const std::vector<Position> &path, Heading startHeading = Heading::ANY) const;
+
+    /**
+     * @brief Count the heading changes along a path
+     * @param path Consecutive 4-connected positions
+     * @param startHeading Heading at the start of the path
+     */
+    static int countTurns(const std::vector<Position> &path, Heading startHeading = Heading::ANY);
+
+    /**
+     * @brief Get search effort of the last search (pathCost is moves plus turn costs)
+     */
+    const SearchStats &getLastSearchStats() const { return lastSearchStats; }
+
+    /**
+     * @brief Get the number of heading changes on the last path (0 if none was found)
+     */
+    int getLastTurns() const { return lastTurns; }
+};
+
+#endif // TURNAWARESEARCH_H
@@ -0,0 +1,343 @@
+/**
+ * @file Visibility.cpp
+ * @brief Visibility fields by symmetric shadowcasting on a bitplane - Implementation File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This file contains the implementation of Visibility: the transparency
+ * bitplane, recursive symmetric shadowcasting with exact slopes, the
+ * least-recently-used field cache and the batched and union queries.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "Visibility.h"
+#include "../TaskPool/TaskPool.h"
+#include <algorithm>
+
+namespace
+{
+    // Sources handed to one task in fieldsFrom()
+    const size_t TASK_GRAIN = 8;
+
+    /**
+     * Slope num / den (den > 0) of a line from the source, in columns per row
+     */
+    struct Slope
+    {
+        long long num;
+        long long den;
+    };
+
+    long long floorDiv(long long a, long long b)
+    {
+        long long quotient = a / b;
+        return (a % b != 0 && (a < 0) != (b < 0)) ? quotient - 1 : quotient;
+    }
+
+    /**
+     * Shadowcasting over one quadrant. Rows run away from the source (depth)
+     * and columns across it; isWall and reveal take (depth, column).
+     */
+    template <typename IsWall, typename Reveal>
+    void scanRow(int depth, Slope start, Slope end, int radius, const IsWall &isWall, const Reveal &reveal)
+    {
+        if (depth > radius)
+            return;
+
+        // Columns whose centers lie within [start, end], rounding ties toward the inside
+        long long minColumn = floorDiv(2 * depth * start.num + start.den, 2 * start.den);
+        long long maxColumn = -floorDiv(-(2 * depth * end.num - end.den), 2 * end.den);
+
+        int previous = -1; // -1 = none yet, 0 = floor, 1 = wall
+        for (long long column = minColumn; column <= maxColumn; ++column)
+        {
+            int col = static_cast<int>(column);
+            bool wall = isWall(depth, col);
+            bool symmetric = column * start.den >= depth * start.num && column * end.den <= depth * end.num;
+            if (wall || symmetric)
+                reveal(depth, col);
+
+            if (previous == 1 && !wall)
+                start = Slope{2 * column - 1, 2LL * depth};
+            if (previous == 0 && wall)
+                scanRow(depth + 1, start, Slope{2 * column - 1, 2LL * depth}, radius, isWall, reveal);
+            previous = wall ? 1 : 0;
+        }
+        if (previous == 0)
+            scanRow(depth + 1, start, end, radius, isWall, reveal);
+    }
+}
+
+size_t VisibilityField::count() const
+{
+    size_t tiles = 0;
+    for (uint64_t word : bits)
+    {
+        tiles += static_cast<size_t>(__builtin_popcountll(word));
+    }
+    return tiles;
+}
+
+std::vector<Position> VisibilityField::tiles() const
+{
+    std::vector<Position> result;
+    result.reserve(count());
+    for (int y = 0; y < height; ++y)
+    {
+        for (int word = 0; word < wordsPerRow; ++word)
+        {
+            for (uint64_t value = bits[static_cast<size_t>(y) * wordsPerRow + word]; value; value &= value - 1)
+            {
+                result.push_back(Position(left + (word << 6) + __builtin_ctzll(value), top + y));
+            }
+        }
+    }
+    return result;
+}
+
+Visibility::Visibility(const PathFinder &engine, int sightRadius, size_t capacity)
+    : pathfinder(engine), radius(std::max(1, sightRadius)), cacheCapacity(capacity), planeVersion(0),
+      planeBuilt(false), width(0), height(0), wordsPerRow(0), cacheHits(0), cacheMisses(0)
+{
+}
+
+bool Visibility::refreshPlane()
+{
+    if (!pathfinder.isMapLoaded())
+        return false;
+    if (planeBuilt && planeVersion == pathfinder.getMapVersion())
+        return true;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    width = map.width;
+    height = map.height;
+    wordsPerRow = (width + 63) / 64;
+    plane.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    for (int y = 0; y < height; ++y)
+    {
+        uint64_t *row = &plane[static_cast<size_t>(y) * wordsPerRow];
+        for (int x = 0; x < width; ++x)
+        {
+            if (map.isReachable(x, y))
+                row[x >> 6] |= uint64_t(1) << (x & 63);
+        }
+    }
+
+    clearCache();
+    planeVersion = pathfinder.getMapVersion();
+    planeBuilt = true;
+    return true;
+}
+
+std::shared_ptr<const VisibilityField> Visibility::compute(const Position &source) const
+{
+    std::shared_ptr<VisibilityField> field = std::make_shared<VisibilityField>();
+    field->source = source;
+    field->radius = radius;
+    if (source.x < 0 || source.y < 0 || source.x >= width || source.y >= height)
+        return field;
+
+    field->left = std::max(0, source.x - radius);
+    field->top = std::max(0, source.y - radius);
+    field->width = std::min(width - 1, source.x + radius) - field->left + 1;
+    field->height = std::min(height - 1, source.y + radius) - field->top + 1;
+    field->wordsPerRow = (field->width + 63) / 64;
+    field->bits.assign(static_cast<size_t>(field->wordsPerRow) * field->height, 0);
+
+    VisibilityField &result = *field;
+    auto mark = [&](int x, int y)
+    {
+        x -= result.left;
+        y -= result.top;
+        result.bits[static_cast<size_t>(y) * result.wordsPerRow + (x >> 6)] |= uint64_t(1) << (x & 63);
+    };
+    mark(source.x, source.y);
+
+    // North, south, east, west: (depth, column) -> map offsets
+    const int depthX[4] = {0, 0, 1, -1};
+    const int depthY[4] = {-1, 1, 0, 0};
+    const int columnX[4] = {1, 1, 0, 0};
+    const int columnY[4] = {0, 0, 1, 1};
+    long long radiusSquared = static_cast<long long>(radius) * radius;
+    for (int quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        auto isWall = [&](int depth, int column)
+        {
+            return !transparent(source.x + depth * depthX[quadrant] + column * columnX[quadrant],
+                                source.y + depth * depthY[quadrant] + column * columnY[quadrant]);
+        };
+        auto reveal = [&](int depth, int column)
+        {
+            int x = source.x + depth * depthX[quadrant] + column * columnX[quadrant];
+            int y = source.y + depth * depthY[quadrant] + column * columnY[quadrant];
+            if (x >= 0 && y >= 0 && x < width && y < height &&
+                static_cast<long long>(depth) * depth + static_cast<long long>(column) * column <= radiusSquared)
+                mark(x, y);
+        };
+        scanRow(1, Slope{-1, 1}, Slope{1, 1}, radius, isWall, reveal);
+    }
+    return field;
+}
+
+std::shared_ptr<const VisibilityField> Visibility::lookup(int index)
+{
+    auto found = cache.find(index);
+    if (found == cache.end())
+        return nullptr;
+    recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, found->second.recency);
+    return found->second.field;
+}
+
+void Visibility::store(int index, const std::shared_ptr<const VisibilityField> &field)
+{
+    if (cacheCapacity == 0 || cache.count(index))
+        return;
+    if (cache.size() >= cacheCapacity)
+    {
+        cache.erase(recentlyUsed.back());
+        recentlyUsed.pop_back();
+    }
+    recentlyUsed.push_front(index);
+    CacheEntry entry;
+    entry.field = field;
+    entry.recency = recentlyUsed.begin();
+    cache[index] = entry;
+}
+
+std::shared_ptr<const VisibilityField> Visibility::fieldFrom(const Position &source)
+{
+    if (!refreshPlane())
+        return std::make_shared<VisibilityField>();
+    if (source.x < 0 || source.y < 0 || source.x >= width || source.y >= height)
+        return compute(source);
+
+    int index = source.y * width + source.x;
+    std::shared_ptr<const VisibilityField> field = lookup(index);
+    if (field)
+    {
+        cacheHits++;
+        return field;
+    }
+    cacheMisses++;
+    field = compute(source);
+    store(index, field);
+    return field;
+}
+
+std::vector<std::shared_ptr<const VisibilityField>> Visibility::fieldsFrom(const std::vector<Position> &sources, int threads)
+{
+    std::vector<std::shared_ptr<const VisibilityField>> fields(sources.size());
+    if (!refreshPlane())
+    {
+        for (auto &field : fields)
+        {
+            field = std::make_shared<VisibilityField>();
+        }
+        return fields;
+    }
+
+    // Serve what the cache has, then compute the rest (each distinct tile once)
+    std::vector<size_t> missing;
+    std::unordered_map<int, size_t> firstMissing;
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        const Position &source = sources[i];
+        if (source.x < 0 || source.y < 0 || source.x >= width || source.y >= height)
+        {
+            fields[i] = compute(source);
+            continue;
+        }
+        int index = source.y * width + source.x;
+        fields[i] = lookup(index);
+        if (fields[i])
+            cacheHits++;
+        else if (firstMissing.insert(std::make_pair(index, i)).second)
+            missing.push_back(i);
+    }
+    cacheMisses += missing.size();
+
+    if (threads > 1 && missing.size() > TASK_GRAIN)
+    {
+        parallelFor(TaskPool::shared(), 0, missing.size(), TASK_GRAIN, threads, [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            fields[missing[i]] = compute(sources[missing[i]]);
+                        } });
+    }
+    else
+    {
+        for (size_t i : missing)
+        {
+            fields[i] = compute(sources[i]);
+        }
+    }
+
+    for (size_t i : missing)
+    {
+        store(sources[i].y * width + sources[i].x, fields[i]);
+    }
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        if (!fields[i])
+            fields[i] = fields[firstMissing[sources[i].y * width + sources[i].x]];
+    }
+    return fields;
+}
+
+bool Visibility::canSee(const Position &from, const Position &to)
+{
+    return fieldFrom(from)->contains(to.x, to.y);
+}
+
+std::vector<Position> Visibility::tilesSeeing(const Position &target)
+{
+    // Symmetric shadowcasting: a transparent tile sees the target exactly when the target sees it
+    std::vector<Position> viewers;
+    for (const Position &tile : fieldFrom(target)->tiles())
+    {
+        if (tile != target && transparent(tile.x, tile.y))
+            viewers.push_back(tile);
+    }
+    return viewers;
+}
+
+VisibilityField Visibility::visibleToAny(const std::vector<Position> &sources, int threads)
+{
+    VisibilityField combined;
+    std::vector<std::shared_ptr<const VisibilityField>> fields = fieldsFrom(sources, threads);
+    if (!planeBuilt)
+        return combined;
+
+    combined.radius = radius;
+    combined.width = width;
+    combined.height = height;
+    combined.wordsPerRow = wordsPerRow;
+    combined.bits.assign(plane.size(), 0);
+    for (const auto &field : fields)
+    {
+        // OR each window row into the map row, shifted to the window's first column
+        int shift = field->left & 63;
+        for (int row = 0; row < field->height; ++row)
+        {
+            uint64_t *target = &combined.bits[static_cast<size_t>(field->top + row) * wordsPerRow + (field->left >> 6)];
+            const uint64_t *source = &field->bits[static_cast<size_t>(row) * field->wordsPerRow];
+            int targetWords = wordsPerRow - (field->left >> 6);
+            for (int word = 0; word < field->wordsPerRow; ++word)
+            {
+                target[word] |= source[word] << shift;
+                if (shift && word + 1 < targetWords)
+                    target[word + 1] |= source[word] >> (64 - shift);
+            }
+        }
+    }
+    return combined;
+}
+
+void Visibility::clearCache()
+{
+    cache.clear();
+    recentlyUsed.clear();
+}
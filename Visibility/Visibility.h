@@ -0,0 +1,227 @@
+/**
+ * @file Visibility.h
+ * @brief Visibility fields by symmetric shadowcasting on a bitplane - Header File
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * This header defines Visibility, which computes what a unit standing on a
+ * tile can see, treating unreachable (3) tiles as occluders. Fields come
+ * from recursive shadowcasting over a packed transparency bitplane, are kept
+ * in a cache keyed by source tile, and can be computed for many sources at
+ * once on the shared TaskPool, e.g. for fog of war.
+ *
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#ifndef VISIBILITY_H
+#define VISIBILITY_H
+
+#include "../PathFinder/PathFinder.h"
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Tiles visible from one source, as a bitset over a window of the map
+ *
+ * Bit (x - left) of row (y - top) is set for every visible tile; rows are
+ * padded to whole 64-bit words. Occluding tiles that bound the view are
+ * visible too, like the walls of a lit room.
+ */
+struct VisibilityField
+{
+    Position source;            ///< Tile the field was computed from, (-1,-1) for a union of fields
+    int radius;                 ///< Sight radius in tiles (Euclidean)
+    int left;                   ///< Map x of the first window column
+    int top;                    ///< Map y of the first window row
+    int width;                  ///< Window width in tiles
+    int height;                 ///< Window height in tiles
+    int wordsPerRow;            ///< 64-bit words per window row
+    std::vector<uint64_t> bits; ///< Visible bit per window tile
+
+    /**
+     * @brief Default constructor creating an empty field
+     */
+    VisibilityField() : source(-1, -1), radius(0), left(0), top(0), width(0), height(0), wordsPerRow(0) {}
+
+    /**
+     * @brief Check whether a map tile is visible
+     * @param x Map x-coordinate
+     * @param y Map y-coordinate
+     */
+    bool contains(int x, int y) const
+    {
+        x -= left;
+        y -= top;
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return false;
+        return (bits[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    /**
+     * @brief Get the number of visible tiles
+     */
+    size_t count() const;
+
+    /**
+     * @brief List the visible tiles, row by row
+     */
+    std::vector<Position> tiles() const;
+};
+
+/**
+ * @brief Visibility engine over a PathFinder's map
+ *
+ * Uses symmetric shadowcasting: each of the four quadrants around the source
+ * is scanned row by row, and a row recurses into the next one once per run
+ * of transparent tiles, narrowing the visible slopes at every occluder.
+ * Slopes are exact fractions of integers. A transparent tile counts as
+ * visible only if its center lies inside the visible slopes, which makes
+ * visibility between transparent tiles symmetric: A sees B exactly when B
+ * sees A. tilesSeeing() relies on this.
+ *
+ * Fields are limited to a Euclidean sight radius and cached per source tile
+ * (least recently used entries are evicted). The cache is dropped when the
+ * PathFinder's map version changes.
+ *
+ * @par Usage Example:
+ * @code
+ * Visibility sight(pathfinder, 12);
+ * if (sight.canSee(sniper, target))
+ *     fire();
+ * std::vector<Position> coverSpots = sight.tilesSeeing(objective);   // Tiles with a view of the objective
+ * VisibilityField fog = sight.visibleToAny(unitPositions, 4);        // Fog of war, up to 4 threads
+ * @endcode
+ *
+ * @note Not thread safe; fieldsFrom() and visibleToAny() parallelize internally.
+ */
+class Visibility
+{
+private:
+    /**
+     * @brief Cached field with its position in the recency list
+     */
+    struct CacheEntry
+    {
+        std::shared_ptr<const VisibilityField> field; ///< Cached field
+        std::list<int>::iterator recency;             ///< Position in recentlyUsed
+    };
+
+    const PathFinder &pathfinder;              ///< Engine providing the map
+    int radius;                                ///< Sight radius of every field
+    size_t cacheCapacity;                      ///< Most fields kept in the cache
+    uint64_t planeVersion;                     ///< Map version the bitplane was built from
+    bool planeBuilt;                           ///< true once the bitplane exists
+    int width;                                 ///< Map width of the bitplane
+    int height;                                ///< Map height of the bitplane
+    int wordsPerRow;                           ///< 64-bit words per bitplane row
+    std::vector<uint64_t> plane;               ///< Transparent bit per tile, one padded row of words per map row
+    std::unordered_map<int, CacheEntry> cache; ///< Source tile index -> field
+    std::list<int> recentlyUsed;               ///< Cached source tiles, most recently used first
+    size_t cacheHits;                          ///< Fields served from the cache
+    size_t cacheMisses;                        ///< Fields computed
+
+    /**
+     * @brief Rebuild the bitplane and drop the cache if the map changed
+     * @return false if no map is loaded
+     */
+    bool refreshPlane();
+
+    /**
+     * @brief Read one bit of the bitplane (false outside the map)
+     */
+    bool transparent(int x, int y) const
+    {
+        if (x < 0 || y < 0 || x >= width || y >= height)
+            return false;
+        return (plane[static_cast<size_t>(y) * wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    /**
+     * @brief Compute one field on the current bitplane
+     *
+     * Only reads the bitplane, so several threads may call it at once.
+     */
+    std::shared_ptr<const VisibilityField> compute(const Position &source) const;
+
+    /**
+     * @brief Look up a cached field and mark it as recently used
+     * @return The field, or null if it is not cached
+     */
+    std::shared_ptr<const VisibilityField> lookup(int index);
+
+    /**
+     * @brief Add a field to the cache, evicting the least recently used one if full
+     */
+    void store(int index, const std::shared_ptr<const VisibilityField> &field);
+
+public:
+    /**
+     * @brief Create an engine over a PathFinder
+     * @param engine Engine providing the map (must outlive this object)
+     * @param sightRadius Sight radius in tiles (at least 1)
+     * @param capacity Most fields kept in the cache (0 disables caching)
+     */
+    explicit Visibility(const PathFinder &engine, int sightRadius = 16, size_t capacity = 1024);
+
+    /**
+     * @brief Get the field of one source tile
+     * @param source Tile the viewer stands on
+     * @return Visible tiles (empty if no map is loaded or the source is off the map)
+     */
+    std::shared_ptr<const VisibilityField> fieldFrom(const Position &source);
+
+    /**
+     * @brief Get the fields of many source tiles
+     * @param sources Tiles the viewers stand on
+     * @param threads Threads to use: 1 = the calling thread, otherwise up to this many shared TaskPool workers
+     * @return One field per source, in order; cached fields are reused and new ones cached
+     */
+    std::vector<std::shared_ptr<const VisibilityField>> fieldsFrom(const std::vector<Position> &sources, int threads = 1);
+
+    /**
+     * @brief Check whether a viewer on one tile sees another tile
+     */
+    bool canSee(const Position &from, const Position &to);
+
+    /**
+     * @brief List the transparent tiles from which a tile can be seen
+     * @param target Transparent tile to be seen
+     * @return Tiles other than the target whose fields contain it
+     */
+    std::vector<Position> tilesSeeing(const Position &target);
+
+    /**
+     * @brief Union of the fields of many sources, e.g. for fog of war
+     * @param sources Tiles the viewers stand on
+     * @param threads Threads to use: 1 = the calling thread, otherwise up to this many shared TaskPool workers
+     * @return Field covering the whole map with every tile some source sees
+     */
+    VisibilityField visibleToAny(const std::vector<Position> &sources, int threads = 1);
+
+    /**
+     * @brief Drop all cached fields
+     */
+    void clearCache();
+
+    /**
+     * @brief Get the sight radius
+     */
+    int getRadius() const { return radius; }
+
+    /**
+     * @brief Get the number of fields served from the cache since construction
+     */
+    size_t getCacheHits() const { return cacheHits; }
+
+    /**
+     * @brief Get the number of fields computed since construction
+     */
+    size_t getCacheMisses() const { return cacheMisses; }
+};
+
+#endif // VISIBILITY_H
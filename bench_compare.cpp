@@ -0,0 +1,118 @@
+/**
+ * @file bench_compare.cpp
+ * @brief Performance regression gate comparing benchmark results to a baseline
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * Compares a new benchmark results file against a stored baseline and exits
+ * with a non-zero status if any workload's latency or node expansions
+ * regressed beyond the configured thresholds. Latency regressions must also be
+ * significant at the chosen confidence level, so runs with few repetitions or
+ * noisy timings do not trigger false alarms.
+ *
+ * Exit status: 0 = no regression, 1 = regression detected, 2 = usage or I/O error
+ *
+ * @see Benchmark, benchmark.cpp
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "Benchmark/Benchmark.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+void printUsage(const char *programName)
+{
+    std::cout << "Usage: " << programName << " <baseline.json> <current.json> [options]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --latency-threshold PCT     - Allowed mean latency increase in percent (default: 5)" << std::endl;
+    std::cout << "  --expansions-threshold PCT  - Allowed node expansion increase in percent (default: 0)" << std::endl;
+    std::cout << "  --confidence LEVEL          - Confidence level: 0.90, 0.95 or 0.99 (default: 0.95)" << std::endl;
+    std::cout << "  --allow-missing             - Do not fail when a baseline workload is missing" << std::endl;
+    std::cout << "  --help or -h                - Show this help message" << std::endl;
+    std::cout << "Example:" << std::endl;
+    std::cout << "  " << programName << " bench_baseline.json bench_results.json --latency-threshold 10" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> files;
+    RegressionThresholds thresholds;
+    bool allowMissing = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+        else if (arg == "--latency-threshold" && i + 1 < argc)
+        {
+            thresholds.latencyPct = std::atof(argv[++i]);
+        }
+        else if (arg == "--expansions-threshold" && i + 1 < argc)
+        {
+            thresholds.expansionsPct = std::atof(argv[++i]);
+        }
+        else if (arg == "--confidence" && i + 1 < argc)
+        {
+            thresholds.confidence = std::atof(argv[++i]);
+        }
+        else if (arg == "--allow-missing")
+        {
+            allowMissing = true;
+        }
+        else
+        {
+            files.push_back(arg);
+        }
+    }
+
+    if (files.size() != 2)
+    {
+        std::cerr << "Error: Baseline and current results files are required." << std::endl;
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::vector<WorkloadResult> baseline;
+    std::vector<WorkloadResult> current;
+    if (!Benchmark::loadResults(files[0], baseline) || !Benchmark::loadResults(files[1], current))
+    {
+        return 2;
+    }
+
+    std::cout << "Baseline: " << files[0] << " (" << baseline.size() << " workloads)" << std::endl;
+    std::cout << "Current:  " << files[1] << " (" << current.size() << " workloads)" << std::endl;
+    std::cout << "Thresholds: latency " << thresholds.latencyPct << "%, expansions "
+              << thresholds.expansionsPct << "%, confidence " << thresholds.confidence << std::endl;
+
+    std::vector<WorkloadComparison> comparisons = Benchmark::compare(baseline, current, thresholds);
+    int regressions = Benchmark::printComparison(comparisons);
+
+    int missing = 0;
+    for (const auto &comparison : comparisons)
+    {
+        if (comparison.inBaseline && !comparison.inCurrent)
+            missing++;
+    }
+
+    if (missing > 0 && !allowMissing)
+    {
+        std::cout << "FAIL: " << missing << " baseline workload(s) missing from current results" << std::endl;
+        return 1;
+    }
+
+    if (regressions > 0)
+    {
+        std::cout << "FAIL: performance regression detected" << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: no performance regression" << std::endl;
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file benchmark.cpp
+ * @brief Benchmark runner for the pathfinding corpus
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * Runs the A*, BFS and DFS algorithms over every battle map of a corpus and
+ * stores per-workload latency samples and search effort as a JSON results
+ * file. The file can be kept as a baseline and compared against later runs
+ * with bench_compare.
+ *
+ * @see Benchmark, bench_compare.cpp
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "Benchmark/Benchmark.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+void printUsage(const char *programName)
+{
+    std::cout << "Usage: " << programName << " [options] [map.json|directory ...]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --output FILE       - Results file to write (default: bench_results.json)" << std::endl;
+    std::cout << "  --repetitions N     - Timed repetitions per workload (default: 30)" << std::endl;
+    std::cout << "  --help or -h        - Show this help message" << std::endl;
+    std::cout << "If no corpus is given, the samples/ directory is used." << std::endl;
+    std::cout << "Example:" << std::endl;
+    std::cout << "  " << programName << " samples --repetitions 50 --output bench_baseline.json" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string outputFile = "bench_results.json";
+    int repetitions = 30;
+    std::vector<std::string> corpusPaths;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+        else if (arg == "--output" && i + 1 < argc)
+        {
+            outputFile = argv[++i];
+        }
+        else if (arg == "--repetitions" && i + 1 < argc)
+        {
+            repetitions = std::atoi(argv[++i]);
+        }
+        else
+        {
+            corpusPaths.push_back(arg);
+        }
+    }
+
+    if (repetitions < 2)
+    {
+        std::cerr << "Error: At least 2 repetitions are needed for confidence intervals" << std::endl;
+        return 1;
+    }
+
+    if (corpusPaths.empty())
+    {
+        corpusPaths.push_back("samples");
+    }
+
+    std::vector<std::string> mapFiles = Benchmark::collectCorpus(corpusPaths);
+    if (mapFiles.empty())
+    {
+        std::cerr << "Error: Benchmark corpus is empty" << std::endl;
+        return 1;
+    }
+
+    std::cout << "=== Pathfinding Benchmark ===" << std::endl;
+    std::cout << "Maps: " << mapFiles.size() << ", repetitions: " << repetitions << std::endl;
+
+    std::vector<WorkloadResult> results;
+    bool allLoaded = Benchmark::runCorpus(mapFiles, repetitions, results);
+
+    if (!Benchmark::saveResults(outputFile, results))
+    {
+        return 1;
+    }
+
+    std::cout << "\n=== Benchmark Results ===" << std::endl;
+    for (const auto &result : results)
+    {
+        std::cout << result.name << ": " << result.meanLatency() << " us (sd " << result.latencyStdDev()
+                  << "), " << result.nodesExpanded << " expansions" << std::endl;
+    }
+    std::cout << "Results written to " << outputFile << std::endl;
+
+    return allLoaded ? 0 : 1;
+}
@@ -13,9 +13,10 @@
  * - Real-time path animation with various styles
  * - Performance benchmarking and algorithm comparison
  *
- * The application can operate in two modes:
+ * The application can operate in three modes:
  * 1. Single-unit pathfinding mode (default)
  * 2. Multi-unit pathfinding mode (with --multi-unit flag)
+ * 3. Batch query mode (with --queries flag) for offline analytics
  *
  * @see PathFinder, MultiUnitPathFinder, PathAnimator
  * @copyright Copyright (c) 2025. All rights reserved.
@@ -25,29 +26,56 @@
 #include "PathFinder/PathFinder.h"
 #include "PathAnimator/PathAnimator.h"
 #include "MultiUnitPathFinder/MultiUnitPathFinder.h"
+#include "BatchQuery/BatchQuery.h"
+#include "TimeSlicedSearch/TimeSlicedSearch.h"
+#include "TaskPool/TaskPool.h"
+#include "DeadEndPruning/DeadEndPruning.h"
+#include "ThetaStar/ThetaStar.h"
+#include "MovementRange/MovementRange.h"
+#include "GoalSetSearch/GoalSetSearch.h"
+#include "Visibility/Visibility.h"
+#include "AlternativePaths/AlternativePaths.h"
+#include "TurnAwareSearch/TurnAwareSearch.h"
 #include <iostream>
 #include <iomanip>
 #include <string>
 #include <chrono>
 #include <algorithm>
+#include <cstdlib>
 
 void printUsage(const char *programName)
 {
     std::cout << "Usage: " << programName << " <battle_map.json> [options]" << std::endl;
     std::cout << "Options:" << std::endl;
-    std::cout << "  --algorithm ALGO    - Pathfinding algorithm (astar, bfs, dfs, all) **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --algorithm ALGO    - Pathfinding algorithm (astar, bfs, dfs, wastar, focal, theta, all) **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --weight W          - Suboptimality bound for wastar and focal (default 1.5, at least 1)" << std::endl;
+    std::cout << "  --prune             - Let A* and BFS skip dead ends and swamps (same path lengths, fewer expansions)" << std::endl;
+    std::cout << "  --smooth            - Print the path as any-angle waypoints after string pulling **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --range N           - Show the tiles the start can reach within N moves **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --attack-range R    - Path to the nearest tile within R of the target with line of sight **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --alternatives K    - Show up to K routes sharing at most half their tiles **SINGLE UNIT ONLY**" << std::endl;
+    std::cout << "  --turn-cost C       - Show the cheapest path when a 90-degree turn costs C moves (reversal 2C) **SINGLE UNIT ONLY**" << std::endl;
     std::cout << "  --move-order ORDER  - Move direction order (e.g., rdlu, uldr, ldru) **BFS and DFS ONLY**" << std::endl;
     std::cout << "  --multi-unit        - Enable multi-unit pathfinding mode" << std::endl;
     std::cout << "  --strategy STRAT    - Multi-unit strategy (sequential, priority, cooperative, wait)" << std::endl;
+    std::cout << "  --congestion W      - Extra cost per unit planned near a tile at about the same time (e.g. 0.25)" << std::endl;
+    std::cout << "  --lanes MODE        - Moves against lane directions (penalize, forbid); uses the map's \"lanes\" layer or two-lane corridors" << std::endl;
     std::cout << "  --animate           - Animate the path after finding it" << std::endl;
     std::cout << "  --step-by-step      - Step-by-step animation (manual control)" << std::endl;
     std::cout << "  --no-animation      - Skip animation (default)" << std::endl;
     std::cout << "  --speed SPEED       - Animation speed (very_slow, slow, normal, fast, very_fast)" << std::endl;
     std::cout << "  --style STYLE       - Animation style (simple, trail, numbered, highlight) **SINGLE UNIT ONLY** " << std::endl;
+    std::cout << "  --queries FILE      - Batch mode: run queries from FILE (sx sy tx ty [algo] lines or MovingAI .scen)" << std::endl;
+    std::cout << "                        Batch algorithms also include 'adaptive' (A* that learns per target)" << std::endl;
+    std::cout << "  --threads N         - Task pool threads (batch mode default: 1, otherwise all cores)" << std::endl;
+    std::cout << "  --emit-paths        - Batch mode: append each path as an r/d/l/u move string" << std::endl;
+    std::cout << "  --schedule          - Batch mode: route A* queries through the deduplicating request scheduler" << std::endl;
+    std::cout << "  --time-slice N      - Run A* as a resumable search in slices of N expansions **SINGLE UNIT ONLY**" << std::endl;
     std::cout << "  --help or -h        - Show this help message" << std::endl;
     std::cout << "Examples:" << std::endl;
     std::cout << "  " << programName << " battle_map.json --algorithm astar --move-order uldr --animate --speed fast" << std::endl;
     std::cout << "  " << programName << " battle_map.json --multi-unit --strategy priority --animate --style trail --speed 200" << std::endl;
+    std::cout << "  " << programName << " battle_map.json --queries queries.txt --threads 8 > results.txt" << std::endl;
 }
 
 void demonstrateMoveOrders(PathFinder &pathfinder, const std::string &selectedAlgorithm)
@@ -129,6 +157,21 @@ ConflictResolutionStrategy parseStrategy(const std::string &strategyStr)
     }
 }
 
+LaneMode parseLaneMode(const std::string &laneStr)
+{
+    if (laneStr == "off")
+        return LaneMode::OFF;
+    else if (laneStr == "penalize")
+        return LaneMode::PENALIZE;
+    else if (laneStr == "forbid")
+        return LaneMode::FORBID;
+    else
+    {
+        std::cout << "Unknown lane mode: " << laneStr << ", lanes disabled" << std::endl;
+        return LaneMode::OFF;
+    }
+}
+
 int countSuccessfulPaths(const PathfindingResult &result)
 {
     int count = 0;
@@ -247,6 +290,55 @@ void displayStepByStepForSuccessfulUnits(const PathfindingResult &result)
     }
 }
 
+int runBatchQueries(const std::string &filename, const std::string &queriesFile, const std::string &algorithm,
+                    const std::string &moveOrder, int threads, bool emitPaths, bool schedule, double weight, bool prune)
+{
+    // Keep stdout for result lines only: route load diagnostics to stderr
+    std::streambuf *stdoutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+
+    MapLoader mapLoader;
+    bool mapLoaded = mapLoader.loadFromFile(filename) && !mapLoader.getLayers().empty();
+
+    PathFinder pathfinder(moveOrder);
+    if (mapLoaded)
+    {
+        const Layer &battleLayer = mapLoader.getLayers()[0];
+        mapLoaded = pathfinder.loadMapFromData(battleLayer.data, battleLayer.width, battleLayer.height);
+    }
+
+    std::cout.rdbuf(stdoutBuffer);
+
+    if (!mapLoaded)
+    {
+        std::cerr << "Failed to load battle map from file: " << filename << std::endl;
+        return 1;
+    }
+
+    std::vector<PathQuery> queries;
+    if (!BatchQuery::loadQueries(queriesFile, algorithm, queries, weight))
+    {
+        return 1;
+    }
+
+    // Worker engines are copies of this one and share the regions
+    DeadEndPruning pruning(pathfinder);
+    if (prune)
+    {
+        pruning.build();
+        pathfinder.setPruning(&pruning);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t found = schedule ? BatchQuery::runScheduled(pathfinder, queries, threads, emitPaths, std::cout)
+                            : BatchQuery::run(pathfinder, queries, threads, emitPaths, std::cout);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+    std::cerr << "Batch complete: " << queries.size() << " queries, " << found << " paths found, "
+              << duration.count() << " ms using " << threads << " thread(s)" << std::endl;
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
     // Check for help flag first (can be anywhere in arguments)
@@ -275,6 +367,20 @@ int main(int argc, char *argv[])
     bool enableAnimation = false;
     bool stepByStepAnimation = false;
     bool multiUnitMode = false;
+    std::string queriesFile;
+    int threads = 1;
+    bool emitPaths = false;
+    bool schedule = false;
+    int timeSlice = 0;
+    double weight = 1.5;
+    bool prune = false;
+    bool smooth = false;
+    int range = -1;
+    int attackRange = 0;
+    int alternatives = 0;
+    int turnCost = 0;
+    double congestion = 0.0;
+    std::string laneStr = "off";
 
     // Parse command line arguments
     for (int i = 2; i < argc; ++i)
@@ -317,6 +423,68 @@ int main(int argc, char *argv[])
         {
             styleStr = argv[++i];
         }
+        else if (arg == "--queries" && i + 1 < argc)
+        {
+            queriesFile = argv[++i];
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            threads = std::max(1, std::atoi(argv[++i]));
+            TaskPool::setSharedThreadCount(threads);
+        }
+        else if (arg == "--emit-paths")
+        {
+            emitPaths = true;
+        }
+        else if (arg == "--schedule")
+        {
+            schedule = true;
+        }
+        else if (arg == "--time-slice" && i + 1 < argc)
+        {
+            timeSlice = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--weight" && i + 1 < argc)
+        {
+            weight = std::atof(argv[++i]);
+            if (weight < 1.0)
+            {
+                std::cerr << "Error: Weight must be at least 1" << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--prune")
+        {
+            prune = true;
+        }
+        else if (arg == "--smooth")
+        {
+            smooth = true;
+        }
+        else if (arg == "--range" && i + 1 < argc)
+        {
+            range = std::max(0, std::atoi(argv[++i]));
+        }
+        else if (arg == "--attack-range" && i + 1 < argc)
+        {
+            attackRange = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--congestion" && i + 1 < argc)
+        {
+            congestion = std::max(0.0, std::atof(argv[++i]));
+        }
+        else if (arg == "--lanes" && i + 1 < argc)
+        {
+            laneStr = argv[++i];
+        }
+        else if (arg == "--alternatives" && i + 1 < argc)
+        {
+            alternatives = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--turn-cost" && i + 1 < argc)
+        {
+            turnCost = std::max(1, std::atoi(argv[++i]));
+        }
         else if (arg == "astar" || arg == "bfs" || arg == "dfs" || arg == "all")
         {
             algorithm = arg;
@@ -327,6 +495,22 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (!queriesFile.empty())
+    {
+        if (!PathFinder::isValidMoveOrder(moveOrder))
+        {
+            std::cerr << "Error: Invalid move order '" << moveOrder << "'" << std::endl;
+            return 1;
+        }
+        if (algorithm != "astar" && algorithm != "bfs" && algorithm != "dfs" && algorithm != "adaptive" &&
+            algorithm != "wastar" && algorithm != "focal")
+        {
+            std::cerr << "Error: Batch mode supports astar, bfs, dfs, adaptive, wastar or focal, not '" << algorithm << "'" << std::endl;
+            return 1;
+        }
+        return runBatchQueries(filename, queriesFile, algorithm, moveOrder, threads, emitPaths, schedule, weight, prune);
+    }
+
     // Parse animation settings
     AnimationStyle animationStyle = PathAnimator::parseAnimationStyle(styleStr);
     AnimationSpeed animationSpeed = PathAnimator::parseAnimationSpeed(speedStr);
@@ -410,6 +594,29 @@ int main(int argc, char *argv[])
         // Set strategy
         ConflictResolutionStrategy strategy = parseStrategy(strategyStr);
         multiPathfinder.setConflictResolutionStrategy(strategy);
+        multiPathfinder.setCongestionAvoidance(congestion);
+
+        LaneMode laneMode = parseLaneMode(laneStr);
+        if (laneMode != LaneMode::OFF)
+        {
+            // Lanes drawn in the map take precedence over generated ones
+            const Layer *laneLayer = nullptr;
+            for (const Layer &layer : layers)
+            {
+                if (layer.name == "lanes")
+                    laneLayer = &layer;
+            }
+            if (laneLayer && multiPathfinder.setLanes(laneLayer->data))
+            {
+                std::cout << "Using lane directions from the map's \"lanes\" layer" << std::endl;
+            }
+            else
+            {
+                int laneTiles = multiPathfinder.generateLanes();
+                std::cout << "Generated lanes for " << laneTiles << " two-lane corridor tiles" << std::endl;
+            }
+            multiPathfinder.setLaneMode(laneMode);
+        }
 
         // Display available strategies
         MultiUnitPathFinder::printConflictResolutionStrategies();
@@ -558,6 +765,16 @@ int main(int argc, char *argv[])
         pathfinder.validateMap();
         pathfinder.getBattleMap().displayMap();
 
+        DeadEndPruning pruning(pathfinder);
+        if (prune)
+        {
+            pruning.build();
+            pathfinder.setPruning(&pruning);
+            const PruningStats &pruningStats = pruning.getStats();
+            std::cout << "Pruning: " << pruningStats.deadEnds << " dead ends (" << pruningStats.deadEndTiles
+                      << " tiles), " << pruningStats.swamps << " swamps (" << pruningStats.swampTiles << " tiles)" << std::endl;
+        }
+
         // Option to demonstrate different move orders
         if (algorithm == "all")
         {
@@ -670,12 +887,62 @@ int main(int argc, char *argv[])
             auto start = std::chrono::high_resolution_clock::now();
             std::vector<Position> path;
 
-            if (algorithm == "astar")
+            if (algorithm == "astar" && timeSlice > 0)
+            {
+                // Resumable search: each slice stands in for one frame's budget
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                TimeSlicedSearch search(pathfinder, battleMap.startPos, battleMap.targetPos);
+                int slices = 0;
+                while (search.getStatus() == SearchStatus::IN_PROGRESS)
+                {
+                    search.step(timeSlice);
+                    slices++;
+                }
+                path = search.getPath();
+                std::cout << "Completed in " << slices << " slices of up to " << timeSlice << " expansions ("
+                          << search.getStats().nodesExpanded << " nodes expanded)" << std::endl;
+            }
+            else if (algorithm == "astar")
                 path = pathfinder.findPathAStar();
             else if (algorithm == "bfs")
                 path = pathfinder.findPathBFS();
             else if (algorithm == "dfs")
                 path = pathfinder.findPathDFS();
+            else if (algorithm == "wastar" || algorithm == "focal")
+            {
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                path = algorithm == "wastar" ? pathfinder.findPathWeightedAStar(battleMap.startPos, battleMap.targetPos, weight)
+                                             : pathfinder.findPathFocal(battleMap.startPos, battleMap.targetPos, weight);
+                const SearchStats &stats = pathfinder.getLastSearchStats();
+                if (!path.empty())
+                {
+                    std::ios::fmtflags flags = std::cout.flags();
+                    std::streamsize precision = std::cout.precision();
+                    std::cout << "Cost " << stats.pathCost << ", optimal at least " << stats.costLowerBound
+                              << " (ratio " << std::fixed << std::setprecision(3) << stats.costRatio
+                              << ", bound " << weight << ", " << stats.nodesExpanded << " nodes expanded)" << std::endl;
+                    std::cout.flags(flags);
+                    std::cout.precision(precision);
+                }
+            }
+            else if (algorithm == "theta")
+            {
+                // Any-angle waypoints, expanded back to tiles for display and animation
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                ThetaStar theta(pathfinder);
+                std::vector<Position> waypoints = theta.findPath(battleMap.startPos, battleMap.targetPos);
+                path = ThetaStar::expandWaypoints(waypoints);
+                if (!waypoints.empty())
+                {
+                    std::ios::fmtflags flags = std::cout.flags();
+                    std::streamsize precision = std::cout.precision();
+                    std::cout << waypoints.size() << " waypoints, Euclidean length " << std::fixed << std::setprecision(2)
+                              << theta.getLastPathLength() << " (" << theta.getLastSearchStats().nodesExpanded
+                              << " nodes expanded)" << std::endl;
+                    std::cout.flags(flags);
+                    std::cout.precision(precision);
+                }
+            }
             else
             {
                 std::cerr << "Error: Unknown algorithm '" << algorithm << "'" << std::endl;
@@ -686,6 +953,88 @@ int main(int argc, char *argv[])
             auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
             std::cout << "Execution time: " << duration.count() << " microseconds" << std::endl;
 
+            if (!path.empty() && smooth)
+            {
+                ThetaStar smoother(pathfinder);
+                std::vector<Position> waypoints = smoother.smoothPath(path);
+                std::cout << "Smoothed to " << waypoints.size() << " waypoints (from " << path.size() << " path tiles):";
+                for (const Position &waypoint : waypoints)
+                {
+                    std::cout << " (" << waypoint.x << "," << waypoint.y << ")";
+                }
+                std::cout << std::endl;
+            }
+
+            if (range >= 0)
+            {
+                MovementRange ranges(pathfinder);
+                RangeMask reachable;
+                ranges.query(pathfinder.getBattleMap().startPos, range, reachable);
+                std::cout << "Movement range " << range << ": " << reachable.count() << " tiles reachable from the start"
+                          << std::endl;
+                pathfinder.getBattleMap().displayMapWithPath(reachable.tiles());
+            }
+
+            if (attackRange > 0)
+            {
+                // One search to every tile that can hit the target, instead of one per tile
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                GoalSetSearch goalSearch(pathfinder);
+                Visibility sight(pathfinder, attackRange);
+                std::vector<Position> approach = goalSearch.findAttackPath(battleMap.startPos, battleMap.targetPos,
+                                                                           attackRange, &sight);
+                if (approach.empty())
+                {
+                    std::cout << "No tile within attack range " << attackRange << " of the target is reachable" << std::endl;
+                }
+                else
+                {
+                    std::cout << "Attack position (" << goalSearch.getLastGoal().x << "," << goalSearch.getLastGoal().y
+                              << ") within range " << attackRange << ": " << approach.size() - 1 << " moves ("
+                              << goalSearch.getLastSearchStats().nodesExpanded << " nodes expanded)" << std::endl;
+                    battleMap.displayMapWithPath(approach);
+                }
+            }
+
+            if (alternatives > 0)
+            {
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                AlternativePaths routes(pathfinder);
+                std::vector<std::vector<Position>> found = routes.findKPaths(battleMap.startPos, battleMap.targetPos,
+                                                                             alternatives, 0.5);
+                std::cout << found.size() << " alternative routes (" << routes.getLastIterations() << " searches, "
+                          << routes.getLastSearchStats().nodesExpanded << " nodes expanded)" << std::endl;
+                for (size_t i = 0; i < found.size(); ++i)
+                {
+                    std::cout << "Route " << i + 1 << ": " << found[i].size() - 1 << " moves" << std::endl;
+                    battleMap.displayMapWithPath(found[i]);
+                }
+            }
+
+            if (turnCost > 0)
+            {
+                const BattleMap &battleMap = pathfinder.getBattleMap();
+                TurnAwareSearch tracks(pathfinder);
+                tracks.setTurnCosts(turnCost, 2 * turnCost);
+                std::vector<Position> route = tracks.findPath(battleMap.startPos, battleMap.targetPos);
+                if (route.empty())
+                {
+                    std::cout << "No turn-aware path found" << std::endl;
+                }
+                else
+                {
+                    std::cout << "Turn-aware path: " << route.size() - 1 << " moves, " << tracks.getLastTurns()
+                              << " turns, cost " << tracks.getLastSearchStats().pathCost << " ("
+                              << tracks.getLastSearchStats().nodesExpanded << " states expanded)" << std::endl;
+                    if (!path.empty())
+                    {
+                        std::cout << "Shortest path: " << path.size() - 1 << " moves, " << TurnAwareSearch::countTurns(path)
+                                  << " turns, cost " << tracks.pathCost(path) << std::endl;
+                    }
+                    battleMap.displayMapWithPath(route);
+                }
+            }
+
             if (!path.empty())
             {
                 PathFinder::displayPath(path);
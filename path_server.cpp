@@ -0,0 +1,164 @@
+/**
+ * @file path_server.cpp
+ * @brief Resident pathfinding server executable
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * Loads one or more battle maps once and serves path, batch and multi-unit
+ * requests over a Unix domain socket until interrupted (SIGINT/SIGTERM).
+ * Clients pay for a socket round trip instead of process start-up and JSON
+ * parsing on every query.
+ *
+ * With --shm the server instead attaches to a shared-memory segment created
+ * by a game engine and serves its request ring (see SharedMap/README.md).
+ *
+ * @see PathServer, PathServer/README.md for the wire protocol
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "PathServer/PathServer.h"
+#include "SharedMap/SharedMap.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <csignal>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+
+namespace
+{
+    PathServer *activeServer = nullptr;
+    std::atomic<bool> sharedMapRunning(false);
+
+    void handleSignal(int)
+    {
+        if (activeServer != nullptr)
+            activeServer->stop();
+        sharedMapRunning = false;
+    }
+
+    int runSharedMap(const std::string &segmentName, const std::string &moveOrder)
+    {
+        SharedMapSegment segment;
+        if (!segment.attach(segmentName))
+        {
+            return 1;
+        }
+
+        const SharedMapHeader &header = segment.getHeader();
+        std::cout << "Attached to " << segmentName << " (" << header.width << "x" << header.height
+                  << ", " << header.requestSlots << " request slots, " << header.resultSlots << " result slots)" << std::endl;
+
+        SharedMapWorker worker(segment, moveOrder);
+        sharedMapRunning = true;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        worker.run(sharedMapRunning);
+        std::cout << "Shared map worker stopped" << std::endl;
+        return 0;
+    }
+}
+
+void printUsage(const char *programName)
+{
+    std::cout << "Usage: " << programName << " [options] <battle_map.json> [more_maps.json ...]" << std::endl;
+    std::cout << "       " << programName << " --shm NAME [--move-order ORDER]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --socket PATH       - Unix domain socket path (default: /tmp/pathfinder.sock)" << std::endl;
+    std::cout << "  --workers N         - Worker threads serving requests (default: hardware threads)" << std::endl;
+    std::cout << "  --shm NAME          - Serve the request ring of shared-memory segment NAME instead of a socket" << std::endl;
+    std::cout << "  --move-order ORDER  - Neighbor order for shared-memory mode (default: rdlu)" << std::endl;
+    std::cout << "  --help or -h        - Show this help message" << std::endl;
+    std::cout << "Maps are numbered in command line order starting at 0." << std::endl;
+    std::cout << "Example:" << std::endl;
+    std::cout << "  " << programName << " --socket /tmp/pf.sock --workers 8 samples/single-unit/sample1_1.json" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string socketPath = "/tmp/pathfinder.sock";
+    int workers = static_cast<int>(std::thread::hardware_concurrency());
+    std::vector<std::string> mapFiles;
+    std::string sharedMapName;
+    std::string moveOrder = "rdlu";
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+        else if (arg == "--socket" && i + 1 < argc)
+        {
+            socketPath = argv[++i];
+        }
+        else if (arg == "--workers" && i + 1 < argc)
+        {
+            workers = std::atoi(argv[++i]);
+        }
+        else if (arg == "--shm" && i + 1 < argc)
+        {
+            sharedMapName = argv[++i];
+        }
+        else if (arg == "--move-order" && i + 1 < argc)
+        {
+            moveOrder = argv[++i];
+        }
+        else
+        {
+            mapFiles.push_back(arg);
+        }
+    }
+
+    if (!sharedMapName.empty())
+    {
+        if (!PathFinder::isValidMoveOrder(moveOrder))
+        {
+            std::cerr << "Error: Invalid move order '" << moveOrder << "'" << std::endl;
+            return 1;
+        }
+        return runSharedMap(sharedMapName, moveOrder);
+    }
+
+    if (mapFiles.empty())
+    {
+        std::cerr << "Error: At least one map file is required." << std::endl;
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (workers < 1)
+    {
+        workers = 1;
+    }
+
+    PathServer server(socketPath, workers);
+    for (const auto &mapFile : mapFiles)
+    {
+        int mapId = server.addMap(mapFile);
+        if (mapId < 0)
+        {
+            return 1;
+        }
+        std::cout << "Map " << mapId << ": " << mapFile << std::endl;
+    }
+
+    if (!server.start())
+    {
+        return 1;
+    }
+
+    activeServer = &server;
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    server.run();
+
+    activeServer = nullptr;
+    return 0;
+}
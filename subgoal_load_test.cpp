@@ -0,0 +1,155 @@
+/**
+ * @file subgoal_load_test.cpp
+ * @brief Checks that SubgoalGraph::load() rejects truncated and corrupt files
+ * @author Shashank Goyal
+ * @date 2025
+ * @version 1.0
+ *
+ * Builds the subgoal graph of a map, saves it, then writes damaged copies of
+ * the file (truncated, oversized counts, bad tile indices, bad offsets and
+ * bad neighbor ids) and expects load() to return false for each of them and
+ * to keep serving the graph it already had. The intact file must still load.
+ *
+ * Exit status: 0 = all checks passed, 1 = a check failed, 2 = usage or I/O error
+ *
+ * @see SubgoalGraph
+ * @copyright Copyright (c) 2025. All rights reserved.
+ */
+
+#include "MapLoader/MapLoader.h"
+#include "PathFinder/PathFinder.h"
+#include "SubgoalGraph/SubgoalGraph.h"
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    // Byte offsets of the header fields written by SubgoalGraph::save()
+    const size_t SUBGOALS_OFFSET = 4 + 4 + 4 + 8;
+    const size_t EDGES_OFFSET = SUBGOALS_OFFSET + 4;
+    const size_t BODY_OFFSET = EDGES_OFFSET + 4;
+
+    std::vector<char> readFile(const std::string &filename)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string &filename, const std::vector<char> &bytes)
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    uint32_t getU32(const std::vector<char> &bytes, size_t offset)
+    {
+        uint32_t value;
+        std::memcpy(&value, &bytes[offset], sizeof(value));
+        return value;
+    }
+
+    std::vector<char> withU32(std::vector<char> bytes, size_t offset, uint32_t value)
+    {
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        return bytes;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        std::cout << "Usage: " << argv[0] << " <battle_map.json>" << std::endl;
+        return 2;
+    }
+
+    MapLoader mapLoader;
+    if (!mapLoader.loadFromFile(argv[1]) || mapLoader.getLayers().empty())
+    {
+        std::cerr << "Error: Failed to load map " << argv[1] << std::endl;
+        return 2;
+    }
+    const Layer &layer = mapLoader.getLayers()[0];
+    PathFinder pathfinder;
+    if (!pathfinder.loadMapFromData(layer.data, layer.width, layer.height))
+        return 2;
+
+    const BattleMap &map = pathfinder.getBattleMap();
+    SubgoalGraph graph(pathfinder);
+    const std::string filename = "subgoal_load_test.ssg";
+    if (!graph.build() || !graph.save(filename))
+    {
+        std::cerr << "Error: Could not build and save the subgoal graph" << std::endl;
+        return 2;
+    }
+    std::vector<char> good = readFile(filename);
+    uint32_t subgoals = getU32(good, SUBGOALS_OFFSET);
+    uint32_t edgeTotal = getU32(good, EDGES_OFFSET);
+    if (subgoals < 2 || edgeTotal == 0)
+    {
+        std::cerr << "Error: Map has too few subgoals to corrupt (" << subgoals << ")" << std::endl;
+        std::remove(filename.c_str());
+        return 2;
+    }
+    size_t offsetsStart = BODY_OFFSET + static_cast<size_t>(subgoals) * 4;
+    size_t edgesStart = offsetsStart + (static_cast<size_t>(subgoals) + 1) * 4;
+
+    int blockedTile = -1;
+    for (int tile = 0; tile < map.width * map.height && blockedTile < 0; ++tile)
+    {
+        if (!map.isReachable(tile % map.width, tile / map.width))
+            blockedTile = tile;
+    }
+
+    struct Case
+    {
+        std::string name;
+        std::vector<char> bytes;
+    };
+    std::vector<Case> cases;
+    cases.push_back({"truncated header", std::vector<char>(good.begin(), good.begin() + EDGES_OFFSET)});
+    cases.push_back({"truncated body", std::vector<char>(good.begin(), good.end() - 1)});
+    cases.push_back({"subgoal count above tile count", withU32(good, SUBGOALS_OFFSET, 0xFFFFFFFFu)});
+    cases.push_back({"edge count above subgoals squared", withU32(good, EDGES_OFFSET, 0xFFFFFFFFu)});
+    cases.push_back({"negative tile index", withU32(good, BODY_OFFSET, 0xFFFFFFFFu)});
+    cases.push_back({"tile index past the map", withU32(good, BODY_OFFSET, map.width * map.height)});
+    cases.push_back({"duplicate tile", withU32(good, BODY_OFFSET + 4, getU32(good, BODY_OFFSET))});
+    if (blockedTile >= 0)
+        cases.push_back({"blocked tile", withU32(good, BODY_OFFSET, blockedTile)});
+    cases.push_back({"first offset not zero", withU32(good, offsetsStart, 1)});
+    cases.push_back({"decreasing offsets", withU32(good, offsetsStart + 4, edgeTotal + 1)});
+    cases.push_back({"last offset not the edge count", withU32(good, edgesStart - 4, edgeTotal - 1)});
+    cases.push_back({"neighbor id past the subgoals", withU32(good, edgesStart, subgoals)});
+
+    Position start = map.hasValidStart ? map.startPos : Position(0, 0);
+    Position target = map.hasValidTarget ? map.targetPos : Position(0, 0);
+    size_t expectedLength = graph.findPath(start, target).size();
+
+    int failures = 0;
+    for (const Case &test : cases)
+    {
+        writeFile(filename, test.bytes);
+        bool loaded = graph.load(filename);
+        bool kept = graph.isBuilt() && graph.subgoalCount() == subgoals &&
+                    graph.findPath(start, target).size() == expectedLength;
+        std::cout << (loaded || !kept ? "FAIL" : "ok  ") << "  " << test.name << std::endl;
+        if (loaded || !kept)
+            failures++;
+    }
+
+    writeFile(filename, good);
+    bool reloaded = graph.load(filename);
+    std::cout << (reloaded ? "ok  " : "FAIL") << "  intact file" << std::endl;
+    if (!reloaded)
+        failures++;
+
+    std::remove(filename.c_str());
+    std::cout << (failures == 0 ? "All checks passed" : "Checks failed: " + std::to_string(failures)) << std::endl;
+    return failures == 0 ? 0 : 1;
+}